@@ -0,0 +1,114 @@
+/*
+    Teardown benchmark: fills lists with NumNodes nodes (10 million by default) and measures how fast
+    they are emptied by LL_DeleteList, by LL_Clear and, for comparison, by removing the head until the
+    list is empty (one node at a time). Filling a list again after LL_Clear is measured too, since it
+    reuses the chunk kept by LL_Clear.
+
+    Build and run from the linked_list folder:
+    $ gcc -O2 -I. -o bench.out bench/bench.c linked_list.c -pthread
+    $ ./bench.out [NumNodes]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+
+#define DEFAULT_NUM_NODES   10000000u
+
+static double Seconds(void);
+static ListStatus_t Fill(List_t* List, unsigned int NumNodes);
+static void Report(const char* Name, unsigned int NumNodes, double Elapsed);
+
+static int Data = 0;
+
+int main(int argc, char** argv)
+{
+    unsigned int NumNodes = (argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : DEFAULT_NUM_NODES);
+    const char* LinkageNames[] = {"single", "double", "XOR"};
+
+    printf("Teardown of %u nodes\n\n", NumNodes);
+
+    for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+    {
+        double Start;
+        printf("%s linked list:\n", LinkageNames[Linkage]);
+
+        /* LL_DeleteList releases the node chunks without visiting the nodes */
+        List_t* List = LL_NewList(Linkage);
+        if(Fill(List, NumNodes) != LL_OK)
+        {
+            return 1;
+        }
+        Start = Seconds();
+        LL_DeleteList(List);
+        Report("LL_DeleteList", NumNodes, Seconds() - Start);
+
+        /* LL_Clear keeps the newest chunk, the next nodes are taken from it */
+        List = LL_NewList(Linkage);
+        if(Fill(List, NumNodes) != LL_OK)
+        {
+            return 1;
+        }
+        Start = Seconds();
+        LL_Clear(List);
+        Report("LL_Clear", NumNodes, Seconds() - Start);
+        Start = Seconds();
+        if(Fill(List, NumNodes) != LL_OK)
+        {
+            return 1;
+        }
+        Report("LL_AddToBack after LL_Clear", NumNodes, Seconds() - Start);
+        LL_DeleteList(List);
+
+        /* Node by node, as a list used to be deleted */
+        List = LL_NewList(Linkage);
+        if(Fill(List, NumNodes) != LL_OK)
+        {
+            return 1;
+        }
+        Start = Seconds();
+        while(LL_RemoveHead(List) == LL_OK)
+        {
+        }
+        Report("LL_RemoveHead loop", NumNodes, Seconds() - Start);
+        LL_DeleteList(List);
+
+        printf("\n");
+    }
+
+    return 0;
+}
+
+static double Seconds(void)
+{
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+static ListStatus_t Fill(List_t* List, unsigned int NumNodes)
+{
+    if(List == NULL)
+    {
+        return LL_NOT_OK;
+    }
+
+    for(unsigned int i = 0; i < NumNodes; i++)
+    {
+        if(LL_AddToBack(List, &Data) != LL_OK)
+        {
+            return LL_NOT_OK;
+        }
+    }
+
+    return LL_OK;
+}
+
+static void Report(const char* Name, unsigned int NumNodes, double Elapsed)
+{
+    printf("    %-30s %9.4f s", Name, Elapsed);
+    if(Elapsed > 0)
+    {
+        printf("  %10.1f M nodes/s", NumNodes / Elapsed / 1e6);
+    }
+    printf("\n");
+}
@@ -0,0 +1,131 @@
+/*
+    Traversal benchmark: sums the values that the nodes of a doubly linked list point to (4 million
+    nodes by default, each value in its own 64-byte object at a random place of a big array), with a
+    LL_GetNext loop and with LL_ForEach, which prefetches LL_PREFETCH_DISTANCE nodes ahead. This is
+    done with the nodes in list order in memory (as LL_AddToBack lays them out), then with the nodes
+    in random order (after sorting the list by a random key). The best of 10 passes is reported.
+
+    Build and run from the linked_list folder (add -DLL_PREFETCH_DISTANCE=K to try another distance):
+    $ gcc -O2 -I. -o foreach_bench.out bench/foreach_bench.c linked_list.c -pthread
+    $ ./foreach_bench.out [NumNodes]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "linked_list.h"
+
+#define DEFAULT_NUM_NODES   4000000u
+#define NUM_PASSES          10
+
+typedef struct
+{
+    int Key;
+    int Value;
+    char Padding[56];
+}Item_t;
+
+static double Seconds(void);
+static int CompareKeys(const void* A, const void* B);
+static ListBool_t AddValue(void* Data, void* Ctx);
+static void Measure(List_t* List, const char* Layout);
+
+int main(int argc, char** argv)
+{
+    unsigned int NumNodes = (argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : DEFAULT_NUM_NODES);
+    Item_t* Items = malloc((size_t)NumNodes * sizeof(Item_t));
+    unsigned int* Order = malloc((size_t)NumNodes * sizeof(unsigned int));
+    List_t* List = LL_NewList(LL_DOUBLE);
+    uint32_t Seed = 12345;
+
+    if((Items == NULL) || (Order == NULL) || (List == NULL))
+    {
+        return 1;
+    }
+
+    /* The nodes point to the objects in a random order */
+    for(unsigned int i = 0; i < NumNodes; i++)
+    {
+        Seed = Seed * 1103515245u + 12345u;
+        Items[i].Key = (int)(Seed >> 1);
+        Items[i].Value = (int)(i & 0xFF);
+        Order[i] = i;
+    }
+    for(unsigned int i = NumNodes; i > 1; i--)
+    {
+        Seed = Seed * 1103515245u + 12345u;
+        unsigned int j = (Seed >> 8) % i;
+        unsigned int Swap = Order[i - 1];
+        Order[i - 1] = Order[j];
+        Order[j] = Swap;
+    }
+    for(unsigned int i = 0; i < NumNodes; i++)
+    {
+        if(LL_AddToBack(List, &Items[Order[i]]) != LL_OK)
+        {
+            return 1;
+        }
+    }
+
+    printf("Traversal of %u nodes, prefetch distance %d\n\n", NumNodes, LL_PREFETCH_DISTANCE);
+    Measure(List, "nodes in list order");
+    LL_Sort(List, CompareKeys);
+    Measure(List, "nodes in random order");
+
+    LL_DeleteList(List);
+    free(Order);
+    free(Items);
+
+    return 0;
+}
+
+static double Seconds(void)
+{
+    struct timespec Now;
+    timespec_get(&Now, TIME_UTC);
+    return (double)Now.tv_sec + Now.tv_nsec / 1e9;
+}
+
+static int CompareKeys(const void* A, const void* B)
+{
+    int KeyA = ((const Item_t*)A)->Key;
+    int KeyB = ((const Item_t*)B)->Key;
+    return (KeyA > KeyB) - (KeyA < KeyB);
+}
+
+static ListBool_t AddValue(void* Data, void* Ctx)
+{
+    *(long long*)Ctx += ((const Item_t*)Data)->Value;
+    return LL_TRUE;
+}
+
+static void Measure(List_t* List, const char* Layout)
+{
+    double LoopBest = 1e9;
+    double ForEachBest = 1e9;
+    long long LoopSum = 0;
+    long long ForEachSum = 0;
+
+    for(unsigned int Pass = 0; Pass < NUM_PASSES; Pass++)
+    {
+        double Start = Seconds();
+        LoopSum = 0;
+        for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetNext(Node))
+        {
+            LoopSum += ((const Item_t*)LL_GetData(Node))->Value;
+        }
+        double Elapsed = Seconds() - Start;
+        LoopBest = (Elapsed < LoopBest ? Elapsed : LoopBest);
+
+        Start = Seconds();
+        ForEachSum = 0;
+        LL_ForEach(List, AddValue, &ForEachSum);
+        Elapsed = Seconds() - Start;
+        ForEachBest = (Elapsed < ForEachBest ? Elapsed : ForEachBest);
+    }
+
+    printf("%s%s\n", Layout, (LoopSum == ForEachSum ? "" : " (the sums differ)"));
+    printf("    %-30s %9.4f s\n", "LL_GetNext loop", LoopBest);
+    printf("    %-30s %9.4f s  %6.2fx\n\n", "LL_ForEach", ForEachBest, LoopBest / ForEachBest);
+}
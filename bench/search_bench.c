@@ -0,0 +1,156 @@
+/*
+    Search benchmark: looks for data pointers in a doubly linked list of 4 million nodes by default,
+    which point to 1000 distinct objects. LL_CountMatches (which compares gathered batches of data
+    pointers, with AVX2 when available) and LL_GetNodeByData (with data that is not in the list, so the
+    whole list is searched) are compared to a LL_GetNext loop doing the same. This is done with the
+    nodes consecutive in memory (LL_FromArray), in list order but in chunks (LL_AddToBack), and in
+    random order (after sorting the list by a random key). The best of 5 passes is reported.
+
+    Build and run from the linked_list folder:
+    $ gcc -O2 -I. -o search_bench.out bench/search_bench.c linked_list.c -pthread
+    $ ./search_bench.out [NumNodes]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "linked_list.h"
+
+#define DEFAULT_NUM_NODES   4000000u
+#define NUM_ITEMS           1000u
+#define NUM_PASSES          5
+
+typedef struct
+{
+    int Key;
+    int Id;
+}Item_t;
+
+static double Seconds(void);
+static int CompareKeys(const void* A, const void* B);
+static void Measure(List_t* List, const char* Layout, void* Present, void* Missing);
+static void Report(const char* Name, double Elapsed, double Reference);
+
+int main(int argc, char** argv)
+{
+    unsigned int NumNodes = (argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : DEFAULT_NUM_NODES);
+    static Item_t Items[NUM_ITEMS + 1];
+    void** Data = malloc((size_t)NumNodes * sizeof(void*));
+    uint32_t Seed = 12345;
+
+    if(Data == NULL)
+    {
+        return 1;
+    }
+
+    for(unsigned int i = 0; i <= NUM_ITEMS; i++)
+    {
+        Seed = Seed * 1103515245u + 12345u;
+        Items[i].Key = (int)(Seed >> 1);
+        Items[i].Id = (int)i;
+    }
+    for(unsigned int i = 0; i < NumNodes; i++)
+    {
+        Seed = Seed * 1103515245u + 12345u;
+        Data[i] = &Items[(Seed >> 8) % NUM_ITEMS];
+    }
+
+    printf("Search of %u nodes\n\n", NumNodes);
+
+    List_t* List = LL_FromArray(LL_DOUBLE, Data, NumNodes);
+    if(List == NULL)
+    {
+        return 1;
+    }
+    Measure(List, "nodes consecutive in memory", &Items[0], &Items[NUM_ITEMS]);
+    LL_DeleteList(List);
+
+    List = LL_NewList(LL_DOUBLE);
+    for(unsigned int i = 0; i < NumNodes; i++)
+    {
+        if(LL_AddToBack(List, Data[i]) != LL_OK)
+        {
+            return 1;
+        }
+    }
+    Measure(List, "nodes in list order, in chunks", &Items[0], &Items[NUM_ITEMS]);
+
+    LL_Sort(List, CompareKeys);
+    Measure(List, "nodes in random order", &Items[0], &Items[NUM_ITEMS]);
+    LL_DeleteList(List);
+    free(Data);
+
+    return 0;
+}
+
+static double Seconds(void)
+{
+    struct timespec Now;
+    timespec_get(&Now, TIME_UTC);
+    return (double)Now.tv_sec + Now.tv_nsec / 1e9;
+}
+
+static int CompareKeys(const void* A, const void* B)
+{
+    int KeyA = ((const Item_t*)A)->Key;
+    int KeyB = ((const Item_t*)B)->Key;
+    return (KeyA > KeyB) - (KeyA < KeyB);
+}
+
+static void Measure(List_t* List, const char* Layout, void* Present, void* Missing)
+{
+    double Best[4] = {1e9, 1e9, 1e9, 1e9};
+    unsigned int LoopCount = 0;
+    unsigned int Count = 0;
+    ListNode_t* LoopFound = NULL;
+    ListNode_t* Found = NULL;
+
+    for(unsigned int Pass = 0; Pass < NUM_PASSES; Pass++)
+    {
+        double Elapsed[4];
+        double Start = Seconds();
+        LoopCount = 0;
+        for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetNext(Node))
+        {
+            LoopCount += (LL_GetData(Node) == Present);
+        }
+        Elapsed[0] = Seconds() - Start;
+
+        Start = Seconds();
+        LL_CountMatches(List, Present, &Count);
+        Elapsed[1] = Seconds() - Start;
+
+        Start = Seconds();
+        for(LoopFound = LL_GetHead(List); LoopFound && (LL_GetData(LoopFound) != Missing); LoopFound = LL_GetNext(LoopFound))
+        {
+        }
+        Elapsed[2] = Seconds() - Start;
+
+        Start = Seconds();
+        Found = LL_GetNodeByData(List, Missing);
+        Elapsed[3] = Seconds() - Start;
+
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            Best[i] = (Elapsed[i] < Best[i] ? Elapsed[i] : Best[i]);
+        }
+    }
+
+    printf("%s%s\n", Layout, ((LoopCount == Count) && (LoopFound == Found) ? "" : " (the results differ)"));
+    Report("count with a LL_GetNext loop", Best[0], Best[0]);
+    Report("LL_CountMatches", Best[1], Best[0]);
+    Report("find with a LL_GetNext loop", Best[2], Best[2]);
+    Report("LL_GetNodeByData", Best[3], Best[2]);
+    printf("\n");
+}
+
+static void Report(const char* Name, double Elapsed, double Reference)
+{
+    printf("    %-30s %9.4f s", Name, Elapsed);
+    if((Elapsed > 0) && (Elapsed != Reference))
+    {
+        printf("  %6.2fx", Reference / Elapsed);
+    }
+    printf("\n");
+}
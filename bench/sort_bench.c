@@ -0,0 +1,164 @@
+/*
+    Sort scaling benchmark: fills a doubly linked list with NumNodes pointers to random ints (10 million
+    by default) and measures LL_Sort, then LL_ParallelSort with 1, 2, 4... threads up to MaxThreads (32
+    by default) and with one thread per processor. The list is filled again with the same data before
+    each sort. Wall-clock time is measured, since the threads of a sort run at the same time.
+
+    Build and run from the linked_list folder:
+    $ gcc -O2 -I. -o sort_bench.out bench/sort_bench.c linked_list.c -pthread
+    $ ./sort_bench.out [NumNodes] [MaxThreads]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "linked_list.h"
+
+#define DEFAULT_NUM_NODES   10000000u
+#define DEFAULT_MAX_THREADS 32u
+
+static double Seconds(void);
+static int CompareInts(const void* A, const void* B);
+static ListStatus_t Fill(List_t* List, int* Values, unsigned int NumNodes);
+static ListStatus_t CheckSorted(List_t* List, unsigned int NumNodes);
+static void Report(const char* Name, double Elapsed, double Reference);
+
+int main(int argc, char** argv)
+{
+    unsigned int NumNodes = (argc > 1 ? (unsigned int)strtoul(argv[1], NULL, 10) : DEFAULT_NUM_NODES);
+    unsigned int MaxThreads = (argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : DEFAULT_MAX_THREADS);
+    int* Values = malloc((size_t)NumNodes * sizeof(int));
+    List_t* List = LL_NewList(LL_DOUBLE);
+    uint32_t Seed = 12345;
+    char Name[64];
+    double Start;
+
+    if((Values == NULL) || (List == NULL))
+    {
+        return 1;
+    }
+
+    for(unsigned int i = 0; i < NumNodes; i++)
+    {
+        Seed = Seed * 1103515245u + 12345u;
+        Values[i] = (int)(Seed >> 1);
+    }
+
+    printf("Sort of %u nodes\n\n", NumNodes);
+
+    if(Fill(List, Values, NumNodes) != LL_OK)
+    {
+        return 1;
+    }
+    Start = Seconds();
+    LL_Sort(List, CompareInts);
+    double Reference = Seconds() - Start;
+    Report("LL_Sort", Reference, Reference);
+    if(CheckSorted(List, NumNodes) != LL_OK)
+    {
+        return 1;
+    }
+
+    /* The last pass uses one thread per processor */
+    for(unsigned int NumThreads = 1; ; NumThreads = (NumThreads * 2 > MaxThreads ? 0 : NumThreads * 2))
+    {
+        if(Fill(List, Values, NumNodes) != LL_OK)
+        {
+            return 1;
+        }
+        Start = Seconds();
+        LL_ParallelSort(List, CompareInts, NumThreads);
+        double Elapsed = Seconds() - Start;
+
+        if(NumThreads > 0)
+        {
+            sprintf(Name, "LL_ParallelSort, %u threads", NumThreads);
+        }
+        else
+        {
+            sprintf(Name, "LL_ParallelSort, auto");
+        }
+        Report(Name, Elapsed, Reference);
+        if(CheckSorted(List, NumNodes) != LL_OK)
+        {
+            return 1;
+        }
+
+        if(NumThreads == 0)
+        {
+            break;
+        }
+    }
+
+    LL_DeleteList(List);
+    free(Values);
+
+    return 0;
+}
+
+static double Seconds(void)
+{
+    struct timespec Now;
+    timespec_get(&Now, TIME_UTC);
+    return (double)Now.tv_sec + Now.tv_nsec / 1e9;
+}
+
+static int CompareInts(const void* A, const void* B)
+{
+    int ValueA = *(const int*)A;
+    int ValueB = *(const int*)B;
+    return (ValueA > ValueB) - (ValueA < ValueB);
+}
+
+static ListStatus_t Fill(List_t* List, int* Values, unsigned int NumNodes)
+{
+    if(LL_Clear(List) != LL_OK)
+    {
+        return LL_NOT_OK;
+    }
+
+    for(unsigned int i = 0; i < NumNodes; i++)
+    {
+        if(LL_AddToBack(List, &Values[i]) != LL_OK)
+        {
+            return LL_NOT_OK;
+        }
+    }
+
+    return LL_OK;
+}
+
+static ListStatus_t CheckSorted(List_t* List, unsigned int NumNodes)
+{
+    unsigned int Count = 0;
+    ListNode_t* Prev = NULL;
+
+    for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetNext(Node))
+    {
+        if(Prev && (CompareInts(LL_GetData(Prev), LL_GetData(Node)) > 0))
+        {
+            break;
+        }
+        Prev = Node;
+        Count++;
+    }
+
+    if(Count != NumNodes)
+    {
+        printf("    the list is not sorted\n");
+        return LL_NOT_OK;
+    }
+
+    return LL_OK;
+}
+
+static void Report(const char* Name, double Elapsed, double Reference)
+{
+    printf("    %-30s %9.4f s", Name, Elapsed);
+    if(Elapsed > 0)
+    {
+        printf("  %6.2fx", Reference / Elapsed);
+    }
+    printf("\n");
+}
@@ -1,378 +1,4939 @@
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include "linked_list.h"
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__) && !defined(LL_NO_SIMD)
+#include <immintrin.h>
+#define LL_HAVE_AVX2                1
+#endif
+
+/* LL_ParallelSort uses Windows threads or POSIX threads (link with -pthread).
+   Building with LL_NO_THREADS makes it sort in the calling thread, like LL_Sort. */
+#if defined(_WIN32) && !defined(LL_NO_THREADS)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#define LL_HAVE_THREADS             1
+typedef HANDLE ListThread_t;
+#elif (defined(__unix__) || defined(__APPLE__)) && !defined(LL_NO_THREADS)
+#include <pthread.h>
+#include <unistd.h>
+#define LL_HAVE_THREADS             1
+typedef pthread_t ListThread_t;
+#endif
+
 #define IS_NULL(Ptr)                (Ptr == NULL ? LL_TRUE : LL_FALSE)
 #define IS_EMPTY(List)              (List->Count == 0 ? LL_TRUE : LL_FALSE)
 #define IS_INVALID_OR_EMPTY(List)   (IS_NULL(List) || IS_EMPTY(List) || IS_NULL(List->Head) || IS_NULL(List->Tail))
+#define IS_SORTED(List)             (List->Compare != NULL ? LL_TRUE : LL_FALSE)
 #define RETURN_LL_NOT_OK_IF(Cond)   do { if(Cond) return LL_NOT_OK; } while(0)
 #define RETURN_NULL_IF(Cond)        do { if(Cond) return NULL; } while(0)
+#define XOR_LINK(NodeA, NodeB)      ((ListNode_t*)((uintptr_t)(NodeA) ^ (uintptr_t)(NodeB)))
+#define IS_INVALID_HANDLE(List, H)  ((H) >= List->Used || IS_NULL(List->Nodes[H].Data))
+#define INLINE_SIZE(Size)           (((Size) + LL_INLINE_ALIGN - 1) / LL_INLINE_ALIGN * LL_INLINE_ALIGN)
+
+/* Number of nodes in the first chunk of a list's pool. Each new chunk is twice as big as the
+   previous one, up to LL_POOL_MAX_CHUNK_SIZE nodes. */
+#ifndef LL_POOL_FIRST_CHUNK_SIZE
+#define LL_POOL_FIRST_CHUNK_SIZE    8
+#endif
+
+#ifndef LL_POOL_MAX_CHUNK_SIZE
+#define LL_POOL_MAX_CHUNK_SIZE      65536
+#endif
+
+/* Number of free nodes a pool has at least before it looks for chunks whose nodes are all free, to
+   give them back to the allocator. Each look goes through all the free nodes, so the next one waits
+   until half as many nodes as the chunks hold were freed again. */
+#ifndef LL_POOL_TRIM_MIN_FREE
+#define LL_POOL_TRIM_MIN_FREE       1024
+#endif
+
+/* Alignment of the values stored in the nodes of inline lists */
+#ifndef LL_INLINE_ALIGN
+#define LL_INLINE_ALIGN             (sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*))
+#endif
+
+/* Number of entries in the first table of a hash index. The table doubles when it's half full. */
+#ifndef LL_HASH_FIRST_CAPACITY
+#define LL_HASH_FIRST_CAPACITY      16
+#endif
+
+/* Size of a Bloom filter: counters per node (when the filter grows), counters in the first filter and
+   counters set by each data pointer. 8 counters per node and 3 counters per data pointer give about
+   3% false positives. */
+#ifndef LL_BLOOM_COUNTERS_PER_NODE
+#define LL_BLOOM_COUNTERS_PER_NODE  8
+#endif
+
+#ifndef LL_BLOOM_FIRST_SIZE
+#define LL_BLOOM_FIRST_SIZE         64
+#endif
+
+#define LL_BLOOM_NUM_HASHES         3
+#define LL_BLOOM_MAX_COUNT          UINT8_MAX
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LL_PREFETCH(Ptr)            __builtin_prefetch(Ptr)
+#else
+#define LL_PREFETCH(Ptr)            ((void)(Ptr))
+#endif
+
+/* Number of nodes gathered in the first batch of LL_FindAll, and at most. Each batch is twice as big
+   as the previous one, so data found near the head is found without gathering many nodes. */
+#define LL_SEARCH_FIRST_BATCH       4
+#define LL_SEARCH_MAX_BATCH         32
+
+/* Alignment of the blocks of unrolled lists, the size of a cache line on most targets */
+#ifndef LL_CACHE_LINE_SIZE
+#define LL_CACHE_LINE_SIZE          64
+#endif
+
+/* Number of sorted runs kept by a merge sort: run i has 2^i nodes, so 32 runs are enough for any count */
+#define LL_SORT_MAX_RUNS            32
+
+/* Number of sorted chains merged at once by a k-way merge, which is also the number of threads used
+   by a parallel sort at most */
+#define LL_MERGE_MAX_CHAINS         64
+
+/* Number of data pointers sampled per thread by a parallel sort to choose the splitters that divide
+   the merging work between the threads */
+#define LL_SORT_SAMPLES_PER_THREAD  256
+
+/* Number of nodes sorted by each thread of a parallel sort at least: shorter lists use fewer threads.
+   Below LL_SORT_SAMPLES_PER_THREAD, fewer data pointers are sampled (one per node). */
+#ifndef LL_SORT_MIN_NODES_PER_THREAD
+#define LL_SORT_MIN_NODES_PER_THREAD 16384
+#endif
+#if LL_SORT_MIN_NODES_PER_THREAD < 1
+#error "LL_SORT_MIN_NODES_PER_THREAD must be at least 1"
+#endif
+
+/* Number of levels of the sentinel tower of a position index. The towers of the nodes have fewer
+   levels, so the top level only holds the sentinel. */
+#ifndef LL_SKIP_MAX_LEVEL
+#define LL_SKIP_MAX_LEVEL           16
+#endif
+
+struct ListChunk
+{
+    ListChunk_t* Next;
+    unsigned int Capacity;
+    void* Nodes[];  /* Capacity nodes of Pool.NodeSize bytes each */
+};
+
+/* Chunk of a pool being trimmed: the addresses of its nodes that were handed out, and its free nodes
+   (linked through their Next field) */
+typedef struct
+{
+    char* Begin;
+    char* End;
+    ListChunk_t* Chunk;
+    ListNode_t* FreeNodes;
+    ListNode_t* LastFreeNode;
+    unsigned int NumFree;
+}ListChunkRange_t;
+
+/* Chunks of the lists that exchanged nodes: a list's nodes may be in chunks allocated by another list,
+   so these chunks are released with the last list of the group. Each list still takes its nodes from
+   its own pool, only joining and leaving the group go through it. A group merged into another one
+   gives its chunks to it and points to it through Parent. NumRefs counts the lists and the groups
+   that point to a group. */
+struct ListPoolGroup
+{
+    ListPoolGroup_t* Parent;
+    ListChunk_t* Chunks;
+    ListChunk_t* LastChunk;
+    unsigned int NumRefs;
+};
+
+/* Lock of all the pool groups (see Static_LockGroups) */
+#if defined(__GNUC__) || defined(__clang__)
+static int GroupLock = 0;
+#elif defined(_MSC_VER)
+static volatile long GroupLock = 0;
+#endif
+
+/* Hash table entry. In the data index of a list, the key is a data pointer, the value is the first
+   node that contains it (NULL when it's not known which node comes first) and the count is the number
+   of nodes that contain it. In the tower map of a position index, the key is a node and the value is
+   its tower. */
+typedef struct
+{
+    void* Key;
+    void* Value;
+    unsigned int Count;
+}ListHashEntry_t;
+
+/* Open addressing table with linear probing, keyed by pointers. Empty entries have a NULL key. */
+struct ListHashIndex
+{
+    size_t Capacity;
+    size_t Count;
+    ListHashEntry_t Entries[];
+};
+
+/* Counting Bloom filter of the data pointers of a list. Each data pointer increments a few counters,
+   so a counter at 0 proves that a data pointer is not in the list. Counters that reach the maximum
+   stay there, since it's not known anymore how many data pointers incremented them. */
+struct ListBloomFilter
+{
+    size_t Size;
+    uint8_t Counters[];
+};
+
+/* Link of a tower on one level: the next and prev towers that reach this level, and the number of
+   positions from this tower to the next one (to the position after the tail if there is no next). */
+typedef struct
+{
+    struct ListSkipTower* Next;
+    struct ListSkipTower* Prev;
+    unsigned int Span;
+}ListSkipLink_t;
+
+/* Tower of a node in a position index. About one node in four has a tower, and each level of a tower
+   is four times as rare as the level below it. */
+typedef struct ListSkipTower
+{
+    ListNode_t* Node;
+    unsigned int Height;
+    ListSkipLink_t Links[];
+}ListSkipTower_t;
+
+/* Position index: a skip list over some of the nodes of a doubly linked list. The sentinel tower is
+   at position 0, before the head, and the towers of the nodes are found through a hash table. The
+   height of the next tower, and a spare tower of that height, are prepared when a node is allocated
+   so that linking the node can't fail. */
+struct ListSkipIndex
+{
+    ListSkipTower_t* Sentinel;
+    ListSkipTower_t* Spare;
+    ListHashIndex_t* Towers;
+    unsigned int NextHeight;
+    uint32_t Seed;
+};
+
+/* Consecutive nodes of a list and their data pointers, gathered by a search */
+typedef struct
+{
+    ListNode_t* Nodes[LL_SEARCH_MAX_BATCH];
+    void* Data[LL_SEARCH_MAX_BATCH];
+    unsigned int Count;
+}ListBatch_t;
+
+/* Compares Count data pointers to Data, returns a bit mask of the equal ones */
+typedef uint32_t (*ListMatchFn_t)(void* const* BatchData, unsigned int Count, void* Data);
+
+/* Head of a sorted chain in the heap of a k-way merge, and the position of the chain among the
+   merged chains (the first one wins on equivalent data) */
+typedef struct
+{
+    ListNode_t* Node;
+    unsigned int Source;
+}ListMergeEntry_t;
+
+typedef enum
+{
+    LL_SORT_RUNS,   /* sort the segment of each task */
+    LL_SORT_CUT,    /* cut the run of each task into pieces, between the splitters */
+    LL_SORT_MERGE   /* merge the pieces that have the same position in every run */
+}ListSortPhase_t;
+
+typedef struct ListSortJob ListSortJob_t;
+
+/* Node sampled by a parallel sort, and the run it is in. Samples with equal data are ordered by run
+   and then by position in the run, so equal data is spread over the pieces like any other data. */
+typedef struct
+{
+    ListNode_t* Node;
+    unsigned int Run;
+}ListSortSample_t;
+
+/* Work of one thread of a parallel sort. Head is a segment of the list, then the sorted run made of
+   it, then the merged piece linked like the list. */
+typedef struct
+{
+    ListSortJob_t* Job;
+    unsigned int Index;
+    unsigned int Count;
+    ListNode_t* Head;
+    ListNode_t* Tail;
+    ListBool_t Contiguous;
+#ifdef LL_HAVE_THREADS
+    ListThread_t Thread;
+#endif
+}ListSortTask_t;
+
+/* Parallel sort: the list is cut into one segment per task, and data is sampled at regular positions
+   on the way. Each task sorts its segment into a run. The sorted samples give NumTasks - 1 splitters,
+   which cut every run into NumTasks pieces. Piece j of every run is then merged by task j, so the
+   merged pieces follow each other in the list. */
+struct ListSortJob
+{
+    List_t* List;
+    ListCompareFn_t Compare;
+    ListSortPhase_t Phase;
+    unsigned int NumTasks;
+    unsigned int NumSamples;
+    ListSortSample_t* Samples;      /* NumSamples samples, then as many for sorting them */
+    ListSortSample_t* Splitters;    /* NumTasks - 1 samples */
+    ListNode_t** Pieces;    /* Pieces[Piece * NumTasks + Run] */
+    ListSortTask_t Tasks[LL_MERGE_MAX_CHAINS];
+};
+
+static void* Static_DefaultAlloc(size_t Size, void* Ctx)
+{
+    (void)Ctx;
+    return malloc(Size);
+}
+
+static void Static_DefaultFree(void* Ptr, void* Ctx)
+{
+    (void)Ctx;
+    free(Ptr);
+}
+
+static List_t* Static_GetOwner(ListNode_t* Node)
+{
+    /* A list merged into another one by LL_Concat forwards its nodes to it. Nothing is changed on the
+       way, so nodes can be looked at by several threads at once. */
+    List_t* Owner = Node->Owner;
+
+    while(Owner->Forward)
+    {
+        Owner = Owner->Forward;
+    }
+
+    return Owner;
+}
+
+static void Static_ReleaseOwner(List_t* Owner)
+{
+    /* Drop a reference to Owner. A list merged into another one counts the nodes and the merged lists
+       that refer to it, and is released once nothing refers to it, which drops its own reference to
+       the list it forwards to. A list that isn't merged only counts the merged lists. */
+    while((--Owner->NumRefs == 0) && Owner->Forward)
+    {
+        List_t* Forward = Owner->Forward;
+
+        if(Owner->PrevAbsorbed)
+        {
+            Owner->PrevAbsorbed->NextAbsorbed = Owner->NextAbsorbed;
+        }
+        else
+        {
+            Forward->Absorbed = Owner->NextAbsorbed;
+        }
+        if(Owner->NextAbsorbed)
+        {
+            Owner->NextAbsorbed->PrevAbsorbed = Owner->PrevAbsorbed;
+        }
+
+        Forward->Allocator.Free(Owner, Forward->Allocator.Ctx);
+        Owner = Forward;
+    }
+}
+
+static void Static_DisownNode(List_t* List, ListNode_t* Node)
+{
+    /* The node of List stops referring to a list merged into List, if it did */
+    if(Node->Owner != List)
+    {
+        List->NumForwarded--;
+        Static_ReleaseOwner(Node->Owner);
+    }
+}
+
+static List_t* Static_ClaimNode(ListNode_t* Node)
+{
+    /* Point a node that is about to be changed straight to its list, so the next lookups are shorter
+       and the merged lists on the way can be released */
+    List_t* List = Static_GetOwner(Node);
+
+    Static_DisownNode(List, Node);
+    Node->Owner = List;
+
+    return List;
+}
+
+static ListNode_t* Static_GetNextNode(List_t* List, ListNode_t* Node, ListNode_t* Prev)
+{
+    /* The Next field of a node in an XOR linked list holds the address of prev XOR the address of next */
+    return (List->Linkage == LL_XOR ? XOR_LINK(Node->Next, Prev) : Node->Next);
+}
+
+static size_t Static_HashSlot(ListHashIndex_t* Index, void* Key)
+{
+    /* Fibonacci hashing, the low bits of a pointer are mostly zero because of alignment */
+    uint64_t Hash = (uint64_t)(uintptr_t)Key * 0x9E3779B97F4A7C15ull;
+    return (size_t)(Hash >> 32) & (Index->Capacity - 1);
+}
+
+static ListHashEntry_t* Static_HashFind(ListHashIndex_t* Index, void* Key)
+{
+    size_t Slot = Static_HashSlot(Index, Key);
+
+    while(Index->Entries[Slot].Key)
+    {
+        if(Index->Entries[Slot].Key == Key)
+        {
+            return &Index->Entries[Slot];
+        }
+        Slot = (Slot + 1) & (Index->Capacity - 1);
+    }
+
+    return NULL;
+}
+
+static ListHashEntry_t* Static_HashInsertEntry(ListHashIndex_t* Index, void* Key)
+{
+    /* Called only for keys that are not in the table yet, and only when there is room */
+    size_t Slot = Static_HashSlot(Index, Key);
+
+    while(Index->Entries[Slot].Key)
+    {
+        Slot = (Slot + 1) & (Index->Capacity - 1);
+    }
+
+    Index->Count++;
+    Index->Entries[Slot].Key = Key;
+    Index->Entries[Slot].Value = NULL;
+    Index->Entries[Slot].Count = 0;
+
+    return &Index->Entries[Slot];
+}
+
+static void Static_HashDeleteEntry(ListHashIndex_t* Index, ListHashEntry_t* Entry)
+{
+    /* Shift back the entries that follow the deleted one in the same probe sequence */
+    size_t Hole = (size_t)(Entry - Index->Entries);
+    size_t Slot = Hole;
+    size_t Mask = Index->Capacity - 1;
+
+    for(;;)
+    {
+        Slot = (Slot + 1) & Mask;
+        if(IS_NULL(Index->Entries[Slot].Key))
+        {
+            break;
+        }
+
+        /* The entry can fill the hole if its home slot is not between the hole and itself */
+        size_t Home = Static_HashSlot(Index, Index->Entries[Slot].Key);
+        if(((Slot - Home) & Mask) >= ((Slot - Hole) & Mask))
+        {
+            Index->Entries[Hole] = Index->Entries[Slot];
+            Hole = Slot;
+        }
+    }
+
+    Index->Entries[Hole].Key = NULL;
+    Index->Count--;
+}
+
+static ListHashIndex_t* Static_HashNew(List_t* List, size_t Capacity)
+{
+    ListHashIndex_t* Index = List->Allocator.Alloc(sizeof(ListHashIndex_t) + Capacity * sizeof(ListHashEntry_t),
+                                                   List->Allocator.Ctx);
+
+    if(Index)
+    {
+        Index->Capacity = Capacity;
+        Index->Count = 0;
+        memset(Index->Entries, 0, Capacity * sizeof(ListHashEntry_t));
+    }
+
+    return Index;
+}
+
+static ListStatus_t Static_HashReserve(List_t* List, ListHashIndex_t** IndexPtr, size_t NumEntries)
+{
+    ListHashIndex_t* Index = *IndexPtr;
+
+    /* Keep the table at most half full, so probe sequences stay short */
+    if(IS_NULL(Index) || (2 * NumEntries <= Index->Capacity))
+    {
+        return LL_OK;
+    }
+
+    size_t Capacity = Index->Capacity;
+    do
+    {
+        Capacity *= 2;
+    } while(2 * NumEntries > Capacity);
+
+    ListHashIndex_t* NewIndex = Static_HashNew(List, Capacity);
+    RETURN_LL_NOT_OK_IF(IS_NULL(NewIndex));
+
+    /* Rehash */
+    for(size_t i = 0; i < Index->Capacity; i++)
+    {
+        if(Index->Entries[i].Key)
+        {
+            *Static_HashInsertEntry(NewIndex, Index->Entries[i].Key) = Index->Entries[i];
+        }
+    }
+
+    List->Allocator.Free(Index, List->Allocator.Ctx);
+    *IndexPtr = NewIndex;
+
+    return LL_OK;
+}
+
+static void Static_HashAdd(List_t* List, ListNode_t* Node)
+{
+    ListHashEntry_t* Entry = Static_HashFind(List->HashIndex, Node->Data);
+
+    if(IS_NULL(Entry))
+    {
+        Entry = Static_HashInsertEntry(List->HashIndex, Node->Data);
+        Entry->Value = Node;
+    }
+    else
+    {
+        /* The data is in several nodes now, the first one will be found by a list traversal */
+        Entry->Value = NULL;
+    }
+
+    Entry->Count++;
+}
+
+static void Static_HashRemove(List_t* List, ListNode_t* Node)
+{
+    ListHashEntry_t* Entry = Static_HashFind(List->HashIndex, Node->Data);
+
+    if(--Entry->Count > 0)
+    {
+        /* Other nodes still contain the data, but it's not known which one comes first */
+        Entry->Value = NULL;
+    }
+    else
+    {
+        Static_HashDeleteEntry(List->HashIndex, Entry);
+    }
+}
+
+static void Static_HashClear(ListHashIndex_t* Index)
+{
+    memset(Index->Entries, 0, Index->Capacity * sizeof(ListHashEntry_t));
+    Index->Count = 0;
+}
+
+static void Static_FreeHashIndex(List_t* List)
+{
+    if(List->HashIndex)
+    {
+        List->Allocator.Free(List->HashIndex, List->Allocator.Ctx);
+        List->HashIndex = NULL;
+    }
+}
+
+static unsigned int Static_SkipRandomHeight(ListSkipIndex_t* Index)
+{
+    /* xorshift32, each pair of zero bits promotes the tower one more level */
+    uint32_t Rand = Index->Seed;
+    Rand ^= Rand << 13;
+    Rand ^= Rand >> 17;
+    Rand ^= Rand << 5;
+    Index->Seed = Rand;
+
+    unsigned int Height = 0;
+    while(((Rand & 3) == 0) && (Height < LL_SKIP_MAX_LEVEL - 1))
+    {
+        Height++;
+        Rand >>= 2;
+    }
+
+    return Height;
+}
+
+static ListSkipTower_t* Static_SkipNewTower(List_t* List, unsigned int Height)
+{
+    ListSkipTower_t* Tower = List->Allocator.Alloc(sizeof(ListSkipTower_t) + Height * sizeof(ListSkipLink_t),
+                                                   List->Allocator.Ctx);
+
+    if(Tower)
+    {
+        Tower->Node = NULL;
+        Tower->Height = Height;
+        memset(Tower->Links, 0, Height * sizeof(ListSkipLink_t));
+    }
+
+    return Tower;
+}
+
+static ListStatus_t Static_SkipReserve(List_t* List)
+{
+    ListSkipIndex_t* Index = List->SkipIndex;
+
+    RETURN_LL_NOT_OK_IF(Static_HashReserve(List, &Index->Towers, Index->Towers->Count + 1) != LL_OK);
+
+    if(Index->NextHeight && IS_NULL(Index->Spare))
+    {
+        Index->Spare = Static_SkipNewTower(List, Index->NextHeight);
+        RETURN_LL_NOT_OK_IF(IS_NULL(Index->Spare));
+    }
+
+    return LL_OK;
+}
+
+/* Finds the last tower at or before Node on each level (the sentinel if Node is NULL) and the positions
+   of these towers. Update and Positions may be NULL. Returns the position of Node, starting at 1. */
+static unsigned int Static_SkipClimb(ListSkipIndex_t* Index, ListNode_t* Node, ListSkipTower_t** Update,
+                                     unsigned int* Positions)
+{
+    ListSkipTower_t* Tower = Index->Sentinel;
+    unsigned int Steps = 0;
+
+    /* Walk back to the nearest node that has a tower */
+    for(; Node; Node = Node->Prev, Steps++)
+    {
+        ListHashEntry_t* Entry = Static_HashFind(Index->Towers, Node);
+        if(Entry)
+        {
+            Tower = Entry->Value;
+            break;
+        }
+    }
+
+    /* Climb back to the sentinel, keeping track of the distance from the tower found above */
+    unsigned int Offsets[LL_SKIP_MAX_LEVEL];
+    unsigned int Offset = 0;
+
+    for(unsigned int Level = 0; Level < LL_SKIP_MAX_LEVEL; Level++)
+    {
+        while(Tower->Height <= Level)
+        {
+            ListSkipTower_t* Prev = Tower->Links[Tower->Height - 1].Prev;
+            Offset += Prev->Links[Tower->Height - 1].Span;
+            Tower = Prev;
+        }
+
+        Offsets[Level] = Offset;
+        if(Update)
+        {
+            Update[Level] = Tower;
+        }
+    }
+
+    /* Only the sentinel reaches the top level, so the total distance is the position of the tower */
+    if(Positions)
+    {
+        for(unsigned int Level = 0; Level < LL_SKIP_MAX_LEVEL; Level++)
+        {
+            Positions[Level] = Offset - Offsets[Level];
+        }
+    }
+
+    return Offset + Steps;
+}
+
+static ListNode_t* Static_SkipGetNodeAt(List_t* List, unsigned int Position)
+{
+    ListSkipTower_t* Tower = List->SkipIndex->Sentinel;
+    unsigned int Reached = 0;
+
+    /* Move forward on each level as long as the target is not passed */
+    for(unsigned int Level = LL_SKIP_MAX_LEVEL; Level-- > 0; )
+    {
+        while(Tower->Links[Level].Next && (Reached + Tower->Links[Level].Span <= Position))
+        {
+            Reached += Tower->Links[Level].Span;
+            Tower = Tower->Links[Level].Next;
+        }
+    }
+
+    /* Finish on the list itself, the next tower is a few nodes away on average */
+    ListNode_t* Node = Tower->Node;
+    if(IS_NULL(Node))
+    {
+        Node = List->Head;
+        Reached = 1;
+    }
+
+    for(; Reached < Position; Reached++)
+    {
+        Node = Node->Next;
+    }
+
+    return Node;
+}
+
+static void Static_SkipInsertTower(List_t* List, ListNode_t* Node, ListNode_t* Prev, ListSkipTower_t* Tower)
+{
+    /* Index a node linked after Prev, giving it the tower if there is one. There must be room for the
+       tower in the hash table. */
+    ListSkipIndex_t* Index = List->SkipIndex;
+    ListSkipTower_t* Update[LL_SKIP_MAX_LEVEL];
+    unsigned int Positions[LL_SKIP_MAX_LEVEL];
+    unsigned int Position = Static_SkipClimb(Index, Prev, Update, Positions) + 1;
+    unsigned int Height = 0;
+
+    if(Tower)
+    {
+        Tower->Node = Node;
+        Static_HashInsertEntry(Index->Towers, Node)->Value = Tower;
+        Height = Tower->Height;
+    }
+
+    for(unsigned int Level = 0; Level < LL_SKIP_MAX_LEVEL; Level++)
+    {
+        ListSkipLink_t* Link = &Update[Level]->Links[Level];
+
+        if(Level < Height)
+        {
+            /* Split the span of the prev tower, the nodes after the new one moved one position further */
+            Tower->Links[Level].Next = Link->Next;
+            Tower->Links[Level].Prev = Update[Level];
+            Tower->Links[Level].Span = Link->Span - (Position - Positions[Level]) + 1;
+
+            if(Link->Next)
+            {
+                Link->Next->Links[Level].Prev = Tower;
+            }
+            Link->Next = Tower;
+            Link->Span = Position - Positions[Level];
+        }
+        else
+        {
+            Link->Span++;
+        }
+    }
+}
+
+static void Static_SkipInsert(List_t* List, ListNode_t* Node, ListNode_t* Prev)
+{
+    /* The tower, if the node gets one, was allocated with the node */
+    ListSkipIndex_t* Index = List->SkipIndex;
+    ListSkipTower_t* Tower = (Index->NextHeight ? Index->Spare : NULL);
+
+    Index->Spare = (Tower ? NULL : Index->Spare);
+    Index->NextHeight = Static_SkipRandomHeight(Index);
+    Static_SkipInsertTower(List, Node, Prev, Tower);
+}
+
+static void Static_SkipFreeTowers(List_t* List, ListSkipTower_t** Towers, unsigned int NumNodes)
+{
+    /* Release towers of Static_SkipNewTowers that won't be linked */
+    if(Towers)
+    {
+        for(unsigned int i = 0; i < NumNodes; i++)
+        {
+            if(Towers[i])
+            {
+                List->Allocator.Free(Towers[i], List->Allocator.Ctx);
+            }
+        }
+        List->Allocator.Free(Towers, List->Allocator.Ctx);
+    }
+}
+
+static ListSkipTower_t** Static_SkipNewTowers(List_t* List, unsigned int NumNodes)
+{
+    /* Allocate the towers of NumNodes nodes about to be linked (NULL for the nodes that get none) */
+    ListSkipIndex_t* Index = List->SkipIndex;
+    ListSkipTower_t** Towers = List->Allocator.Alloc(NumNodes * sizeof(ListSkipTower_t*), List->Allocator.Ctx);
+    RETURN_NULL_IF(IS_NULL(Towers));
+
+    unsigned int i = 0;
+    unsigned int NumTowers = 0;
+
+    for(; i < NumNodes; i++)
+    {
+        unsigned int Height = Static_SkipRandomHeight(Index);
+        Towers[i] = NULL;
+
+        if(Height)
+        {
+            Towers[i] = Static_SkipNewTower(List, Height);
+            if(IS_NULL(Towers[i]))
+            {
+                break;
+            }
+            NumTowers++;
+        }
+    }
+
+    if((i < NumNodes) || (Static_HashReserve(List, &Index->Towers, Index->Towers->Count + NumTowers) != LL_OK))
+    {
+        Static_SkipFreeTowers(List, Towers, i);
+        return NULL;
+    }
+
+    return Towers;
+}
+
+static void Static_SkipRemove(List_t* List, ListNode_t* Node)
+{
+    ListSkipIndex_t* Index = List->SkipIndex;
+    ListSkipTower_t* Update[LL_SKIP_MAX_LEVEL];
+    Static_SkipClimb(Index, Node, Update, NULL);
+
+    /* On the levels of the node's tower, Update holds the tower itself */
+    ListSkipTower_t* Tower = Update[0];
+
+    for(unsigned int Level = 0; Level < LL_SKIP_MAX_LEVEL; Level++)
+    {
+        if(Update[Level]->Node == Node)
+        {
+            ListSkipLink_t* Link = &Tower->Links[Level];
+            ListSkipTower_t* Prev = Link->Prev;
+
+            Prev->Links[Level].Next = Link->Next;
+            Prev->Links[Level].Span += Link->Span - 1;
+            if(Link->Next)
+            {
+                Link->Next->Links[Level].Prev = Prev;
+            }
+        }
+        else
+        {
+            Update[Level]->Links[Level].Span--;
+        }
+    }
+
+    if(Tower->Node == Node)
+    {
+        Static_HashDeleteEntry(Index->Towers, Static_HashFind(Index->Towers, Node));
+        List->Allocator.Free(Tower, List->Allocator.Ctx);
+    }
+}
+
+static ListStatus_t Static_SkipBuild(List_t* List)
+{
+    /* Give towers to the nodes already in the list, the index must have no towers yet */
+    ListSkipIndex_t* Index = List->SkipIndex;
+    ListSkipTower_t* Last[LL_SKIP_MAX_LEVEL];
+    unsigned int LastPositions[LL_SKIP_MAX_LEVEL];
+    unsigned int Position = 0;
+    ListStatus_t Status = LL_OK;
+
+    for(unsigned int Level = 0; Level < LL_SKIP_MAX_LEVEL; Level++)
+    {
+        Last[Level] = Index->Sentinel;
+        LastPositions[Level] = 0;
+    }
+
+    for(ListNode_t* Node = List->Head; Node; Node = Node->Next)
+    {
+        unsigned int Height = Static_SkipRandomHeight(Index);
+        Position++;
+
+        if(Height == 0)
+        {
+            continue;
+        }
+
+        Status = Static_HashReserve(List, &Index->Towers, Index->Towers->Count + 1);
+        ListSkipTower_t* Tower = (Status == LL_OK ? Static_SkipNewTower(List, Height) : NULL);
+        if(IS_NULL(Tower))
+        {
+            Status = LL_NOT_OK;
+            break;
+        }
+
+        Tower->Node = Node;
+        Static_HashInsertEntry(Index->Towers, Node)->Value = Tower;
+
+        for(unsigned int Level = 0; Level < Height; Level++)
+        {
+            Last[Level]->Links[Level].Next = Tower;
+            Last[Level]->Links[Level].Span = Position - LastPositions[Level];
+            Tower->Links[Level].Prev = Last[Level];
+            Last[Level] = Tower;
+            LastPositions[Level] = Position;
+        }
+    }
+
+    /* End every level after the tail (also on failure, so the towers can be freed) */
+    for(unsigned int Level = 0; Level < LL_SKIP_MAX_LEVEL; Level++)
+    {
+        Last[Level]->Links[Level].Next = NULL;
+        Last[Level]->Links[Level].Span = List->Count + 1 - LastPositions[Level];
+    }
+
+    return Status;
+}
+
+static void Static_SkipClear(List_t* List)
+{
+    /* Free the towers of the nodes, every level of the sentinel goes straight to the position after the tail */
+    ListSkipIndex_t* Index = List->SkipIndex;
+    ListSkipTower_t* Tower = Index->Sentinel->Links[0].Next;
+
+    while(Tower)
+    {
+        ListSkipTower_t* Next = Tower->Links[0].Next;
+        List->Allocator.Free(Tower, List->Allocator.Ctx);
+        Tower = Next;
+    }
+
+    for(unsigned int Level = 0; Level < LL_SKIP_MAX_LEVEL; Level++)
+    {
+        Index->Sentinel->Links[Level].Next = NULL;
+        Index->Sentinel->Links[Level].Span = 1;
+    }
+
+    Static_HashClear(Index->Towers);
+}
+
+static void Static_FreeSkipIndex(List_t* List)
+{
+    ListSkipIndex_t* Index = List->SkipIndex;
+
+    if(Index)
+    {
+        /* Every tower is on the first level */
+        ListSkipTower_t* Tower = Index->Sentinel;
+        while(Tower)
+        {
+            ListSkipTower_t* Next = Tower->Links[0].Next;
+            List->Allocator.Free(Tower, List->Allocator.Ctx);
+            Tower = Next;
+        }
+
+        if(Index->Spare)
+        {
+            List->Allocator.Free(Index->Spare, List->Allocator.Ctx);
+        }
+        if(Index->Towers)
+        {
+            List->Allocator.Free(Index->Towers, List->Allocator.Ctx);
+        }
+
+        List->Allocator.Free(Index, List->Allocator.Ctx);
+        List->SkipIndex = NULL;
+    }
+}
+
+static void Static_BloomSlots(ListBloomFilter_t* Filter, void* Data, size_t* Slots)
+{
+    /* Double hashing: the slots are h1, h1 + h2, h1 + 2 * h2, with h1 and h2 taken from a mixed pointer */
+    uint64_t Hash = (uint64_t)(uintptr_t)Data;
+    Hash ^= Hash >> 33;
+    Hash *= 0xFF51AFD7ED558CCDull;
+    Hash ^= Hash >> 33;
+    Hash *= 0xC4CEB9FE1A85EC53ull;
+    Hash ^= Hash >> 33;
+
+    size_t Hash1 = (size_t)(Hash & 0xFFFFFFFFu);
+    size_t Hash2 = (size_t)(Hash >> 32) | 1;
+
+    for(unsigned int i = 0; i < LL_BLOOM_NUM_HASHES; i++)
+    {
+        Slots[i] = (Hash1 + i * Hash2) & (Filter->Size - 1);
+    }
+}
+
+static void Static_BloomAdd(ListBloomFilter_t* Filter, void* Data)
+{
+    size_t Slots[LL_BLOOM_NUM_HASHES];
+    Static_BloomSlots(Filter, Data, Slots);
+
+    for(unsigned int i = 0; i < LL_BLOOM_NUM_HASHES; i++)
+    {
+        if(Filter->Counters[Slots[i]] < LL_BLOOM_MAX_COUNT)
+        {
+            Filter->Counters[Slots[i]]++;
+        }
+    }
+}
+
+static void Static_BloomRemove(ListBloomFilter_t* Filter, void* Data)
+{
+    size_t Slots[LL_BLOOM_NUM_HASHES];
+    Static_BloomSlots(Filter, Data, Slots);
+
+    for(unsigned int i = 0; i < LL_BLOOM_NUM_HASHES; i++)
+    {
+        if(Filter->Counters[Slots[i]] < LL_BLOOM_MAX_COUNT)
+        {
+            Filter->Counters[Slots[i]]--;
+        }
+    }
+}
+
+static ListBool_t Static_BloomMayContain(ListBloomFilter_t* Filter, void* Data)
+{
+    size_t Slots[LL_BLOOM_NUM_HASHES];
+    Static_BloomSlots(Filter, Data, Slots);
+
+    for(unsigned int i = 0; i < LL_BLOOM_NUM_HASHES; i++)
+    {
+        if(Filter->Counters[Slots[i]] == 0)
+        {
+            return LL_FALSE;
+        }
+    }
+
+    return LL_TRUE;
+}
+
+static ListStatus_t Static_BloomBuild(List_t* List, size_t Size)
+{
+    /* Replace the filter with a new one of the given size, filled with the data of the nodes in the list */
+    ListBloomFilter_t* Filter = List->Allocator.Alloc(sizeof(ListBloomFilter_t) + Size, List->Allocator.Ctx);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Filter));
+
+    Filter->Size = Size;
+    memset(Filter->Counters, 0, Size);
+
+    ListNode_t* Iter = List->Head;
+    ListNode_t* IterPrev = NULL;
+
+    while(Iter)
+    {
+        Static_BloomAdd(Filter, Iter->Data);
+
+        ListNode_t* Next = Static_GetNextNode(List, Iter, IterPrev);
+        IterPrev = Iter;
+        Iter = Next;
+    }
+
+    if(List->BloomFilter)
+    {
+        List->Allocator.Free(List->BloomFilter, List->Allocator.Ctx);
+    }
+    List->BloomFilter = Filter;
+
+    return LL_OK;
+}
+
+static ListStatus_t Static_BloomReserve(List_t* List, size_t NumNodes)
+{
+    /* The false positive rate grows with the number of nodes, so the filter is rebuilt twice as big
+       when there are too few counters per node */
+    size_t Size = List->BloomFilter->Size;
+
+    if(NumNodes * LL_BLOOM_COUNTERS_PER_NODE <= Size)
+    {
+        return LL_OK;
+    }
+
+    while(NumNodes * LL_BLOOM_COUNTERS_PER_NODE > Size)
+    {
+        Size *= 2;
+    }
+
+    return Static_BloomBuild(List, Size);
+}
+
+static void Static_FreeBloomFilter(List_t* List)
+{
+    if(List->BloomFilter)
+    {
+        List->Allocator.Free(List->BloomFilter, List->Allocator.Ctx);
+        List->BloomFilter = NULL;
+    }
+}
+
+static void Static_PushFreeNode(ListPool_t* Pool, ListNode_t* Node)
+{
+    if(IS_NULL(Pool->FreeNodes))
+    {
+        Pool->LastFreeNode = Node;
+    }
+    Node->Next = Pool->FreeNodes;
+    Pool->FreeNodes = Node;
+    Pool->NumFree++;
+}
+
+static void Static_SetTrimPoint(ListPool_t* Pool)
+{
+    /* Going through the free nodes again is only worth it once many more nodes are free */
+    unsigned int Wait = (Pool->Capacity / 2 > LL_POOL_TRIM_MIN_FREE ? Pool->Capacity / 2 : LL_POOL_TRIM_MIN_FREE);
+    Pool->TrimAt = Pool->NumFree + Wait;
+}
+
+static int Static_CompareRanges(const void* A, const void* B)
+{
+    const char* BeginA = ((const ListChunkRange_t*)A)->Begin;
+    const char* BeginB = ((const ListChunkRange_t*)B)->Begin;
+    return (BeginA > BeginB) - (BeginA < BeginB);
+}
+
+static ListChunkRange_t* Static_FindRange(ListChunkRange_t* Ranges, unsigned int NumRanges, char* Node)
+{
+    /* The ranges are sorted by address and don't overlap */
+    unsigned int Low = 0;
+    unsigned int High = NumRanges;
+
+    while(Low < High)
+    {
+        unsigned int Mid = Low + (High - Low) / 2;
+        if(Node < Ranges[Mid].Begin)
+        {
+            High = Mid;
+        }
+        else if(Node >= Ranges[Mid].End)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            return &Ranges[Mid];
+        }
+    }
+
+    return NULL;
+}
+
+static void Static_TrimPool(List_t* List)
+{
+    /* Sort the free nodes by chunk, give the chunks whose handed out nodes are all free back to the
+       allocator (except the one nodes are handed out from) and link the free nodes of the other chunks
+       again. Only the free nodes are visited, never the nodes in use. Trimming is skipped if there
+       isn't enough memory to sort the free nodes. */
+    ListPool_t* Pool = &List->Pool;
+    ListChunkRange_t* Ranges = NULL;
+    ListChunkRange_t* Range = NULL;
+    unsigned int NumRanges = 0;
+
+    for(ListChunk_t* Chunk = Pool->Chunks; Chunk; Chunk = Chunk->Next)
+    {
+        NumRanges++;
+    }
+    if((NumRanges < 2) ||
+       IS_NULL((Ranges = List->Allocator.Alloc(NumRanges * sizeof(ListChunkRange_t), List->Allocator.Ctx))))
+    {
+        Static_SetTrimPoint(Pool);
+        return;
+    }
+
+    NumRanges = 0;
+    for(ListChunk_t* Chunk = Pool->Chunks; Chunk; Chunk = Chunk->Next)
+    {
+        Range = &Ranges[NumRanges++];
+        Range->Begin = (char*)Chunk->Nodes;
+        Range->End = Range->Begin + Chunk->Capacity * Pool->NodeSize;
+        Range->End = ((Pool->Unused >= Range->Begin) && (Pool->Unused <= Range->End)) ? Pool->Unused : Range->End;
+        Range->Chunk = Chunk;
+        Range->FreeNodes = Range->LastFreeNode = NULL;
+        Range->NumFree = 0;
+    }
+    qsort(Ranges, NumRanges, sizeof(ListChunkRange_t), Static_CompareRanges);
+
+    /* Free nodes are mostly next to the previous one, so the last range is tried first */
+    Range = &Ranges[0];
+    for(ListNode_t* Node = Pool->FreeNodes, *Next = NULL; Node; Node = Next)
+    {
+        Next = Node->Next;
+        if(((char*)Node < Range->Begin) || ((char*)Node >= Range->End))
+        {
+            Range = Static_FindRange(Ranges, NumRanges, (char*)Node);
+        }
+        Node->Next = Range->FreeNodes;
+        Range->FreeNodes = Node;
+        Range->LastFreeNode = (Range->LastFreeNode ? Range->LastFreeNode : Node);
+        Range->NumFree++;
+    }
+
+    /* A chunk given back is told apart by its capacity of 0 */
+    Pool->FreeNodes = Pool->LastFreeNode = NULL;
+    for(unsigned int i = 0; i < NumRanges; i++)
+    {
+        Range = &Ranges[i];
+        if((Range->End == Range->Begin + Range->Chunk->Capacity * Pool->NodeSize) &&
+           (Range->NumFree == Range->Chunk->Capacity) && (Pool->Unused != Range->End))
+        {
+            Pool->NumFree -= Range->NumFree;
+            Pool->Capacity -= Range->Chunk->Capacity;
+            Range->Chunk->Capacity = 0;
+        }
+        else if(Range->FreeNodes)
+        {
+            Range->LastFreeNode->Next = Pool->FreeNodes;
+            Pool->FreeNodes = Range->FreeNodes;
+            Pool->LastFreeNode = (Pool->LastFreeNode ? Pool->LastFreeNode : Range->LastFreeNode);
+        }
+    }
+    List->Allocator.Free(Ranges, List->Allocator.Ctx);
+
+    Pool->LastChunk = NULL;
+    for(ListChunk_t** Link = &Pool->Chunks; *Link; )
+    {
+        ListChunk_t* Chunk = *Link;
+        if(Chunk->Capacity == 0)
+        {
+            *Link = Chunk->Next;
+            List->Allocator.Free(Chunk, List->Allocator.Ctx);
+        }
+        else
+        {
+            Pool->LastChunk = Chunk;
+            Link = &Chunk->Next;
+        }
+    }
+
+    Static_SetTrimPoint(Pool);
+}
+
+static void Static_FreeNode(List_t* List, ListNode_t* Node)
+{
+    /* Push the node back to the free list. Once many nodes are free, the chunks that became empty are
+       released (the chunks shared with other lists stay with their group). */
+    ListPool_t* Pool = &List->Pool;
+    Static_DisownNode(List, Node);
+    Static_PushFreeNode(Pool, Node);
+
+    if((Pool->NumFree >= Pool->TrimAt) && IS_NULL(List->PoolGroup))
+    {
+        Static_TrimPool(List);
+    }
+}
+
+static void Static_UnXorLinks(List_t* List)
+{
+    /* Turn the XOR links of the nodes into plain Next links */
+    ListNode_t* Node = List->Head;
+    ListNode_t* Prev = NULL;
+
+    while(Node)
+    {
+        ListNode_t* Next = XOR_LINK(Node->Next, Prev);
+        Node->Next = Next;
+        Prev = Node;
+        Node = Next;
+    }
+}
+
+static void Static_ReleaseNodes(List_t* List)
+{
+    /* Give all the nodes of the list back to its pool at once */
+    ListPool_t* Pool = &List->Pool;
+
+    if(IS_NULL(List->Head))
+    {
+        return;
+    }
+
+    if(List->Linkage == LL_XOR)
+    {
+        /* The free list is linked through plain Next pointers */
+        Static_UnXorLinks(List);
+    }
+
+    /* The nodes are already linked from head to tail, like a free list */
+    if(IS_NULL(Pool->FreeNodes))
+    {
+        Pool->LastFreeNode = List->Tail;
+    }
+    List->Tail->Next = Pool->FreeNodes;
+    Pool->FreeNodes = List->Head;
+    Pool->NumFree += List->Count;
+}
+
+static ListStatus_t Static_GrowPool(List_t* List, unsigned int MinCapacity)
+{
+    ListPool_t* Pool = &List->Pool;
+    unsigned int Capacity = LL_POOL_FIRST_CHUNK_SIZE;
+
+    if(Pool->LastCapacity)
+    {
+        Capacity = Pool->LastCapacity * 2;
+        Capacity = (Capacity > LL_POOL_MAX_CHUNK_SIZE ? LL_POOL_MAX_CHUNK_SIZE : Capacity);
+    }
+    Capacity = (Capacity < MinCapacity ? MinCapacity : Capacity);
+
+    size_t Size = sizeof(ListChunk_t) + Capacity * Pool->NodeSize;
+    ListChunk_t* Chunk = List->Allocator.Alloc(Size, List->Allocator.Ctx);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Chunk));
+
+    /* Link the chunk into the pool so it can be released on LL_DeleteList */
+    if(IS_NULL(Pool->Chunks))
+    {
+        Pool->LastChunk = Chunk;
+    }
+    Chunk->Next = Pool->Chunks;
+    Chunk->Capacity = Capacity;
+    Pool->Chunks = Chunk;
+    Pool->LastCapacity = Capacity;
+    Pool->Capacity += Capacity;
+
+    /* Whatever was left unused in the previous chunk goes to the free list */
+    for(; Pool->Unused < Pool->UnusedEnd; Pool->Unused += Pool->NodeSize)
+    {
+        Static_PushFreeNode(Pool, (ListNode_t*)Pool->Unused);
+    }
+
+    /* New nodes are handed out from the start of the chunk */
+    Pool->Unused = (char*)Chunk->Nodes;
+    Pool->UnusedEnd = Pool->Unused + Capacity * Pool->NodeSize;
+    Static_SetTrimPoint(Pool);
+
+    return LL_OK;
+}
+
+static ListStatus_t Static_ReserveNodes(List_t* List, unsigned int NumNodes)
+{
+    /* Make sure the newest chunk has NumNodes consecutive unused nodes */
+    ListPool_t* Pool = &List->Pool;
+
+    if((size_t)(Pool->UnusedEnd - Pool->Unused) / Pool->NodeSize >= NumNodes)
+    {
+        return LL_OK;
+    }
+
+    return Static_GrowPool(List, NumNodes);
+}
+
+static ListNode_t* Static_NewNode(List_t* List)
+{
+    ListPool_t* Pool = &List->Pool;
+    ListNode_t* Node = Pool->FreeNodes;
+
+    /* Make room for the new node's data in the hash index now: linking a node can't fail */
+    RETURN_NULL_IF(Static_HashReserve(List, &List->HashIndex, List->Count + 1) != LL_OK);
+    RETURN_NULL_IF(List->SkipIndex && (Static_SkipReserve(List) != LL_OK));
+    RETURN_NULL_IF(List->BloomFilter && (Static_BloomReserve(List, List->Count + 1) != LL_OK));
+
+    if(Node)
+    {
+        /* Reuse a removed node */
+        Pool->FreeNodes = Node->Next;
+        Pool->NumFree--;
+    }
+    else
+    {
+        /* Take the next unused node of the newest chunk, allocate a new chunk if there is none */
+        RETURN_NULL_IF((Pool->Unused == Pool->UnusedEnd) && (Static_GrowPool(List, 1) != LL_OK));
+        Node = (ListNode_t*)Pool->Unused;
+        Pool->Unused += Pool->NodeSize;
+    }
+
+    /* Only nodes of doubly linked lists have a Prev field */
+    Node->Owner = List;
+    Node->Data = Node->Next = NULL;
+    if(List->Linkage == LL_DOUBLE)
+    {
+        Node->Prev = NULL;
+    }
+
+    return Node;
+}
+
+static void Static_FreeChunkChain(List_t* List, ListChunk_t* Chunk)
+{
+    while(Chunk)
+    {
+        ListChunk_t* Next = Chunk->Next;
+        List->Allocator.Free(Chunk, List->Allocator.Ctx);
+        Chunk = Next;
+    }
+}
+
+static void Static_FreeChunks(List_t* List, ListPool_t* Pool)
+{
+    Static_FreeChunkChain(List, Pool->Chunks);
+
+    Pool->Chunks = NULL;
+    Pool->FreeNodes = NULL;
+    Pool->Unused = Pool->UnusedEnd = NULL;
+    Pool->NumFree = Pool->Capacity = 0;
+}
+
+static void Static_AppendChunks(ListChunk_t** Chunks, ListChunk_t** LastChunk, ListChunk_t** FromChunks,
+                                ListChunk_t** FromLastChunk)
+{
+    /* Move a chain of chunks to the end of another one, without visiting them */
+    if(*FromChunks)
+    {
+        if(*Chunks)
+        {
+            (*LastChunk)->Next = *FromChunks;
+        }
+        else
+        {
+            *Chunks = *FromChunks;
+        }
+        *LastChunk = *FromLastChunk;
+        *FromChunks = NULL;
+    }
+}
+
+static void Static_AbsorbPool(ListPool_t* Pool, ListPool_t* From)
+{
+    /* Move the chunks and the free nodes of From to Pool, without visiting them */
+    Static_AppendChunks(&Pool->Chunks, &Pool->LastChunk, &From->Chunks, &From->LastChunk);
+
+    if(From->FreeNodes)
+    {
+        if(Pool->FreeNodes)
+        {
+            Pool->LastFreeNode->Next = From->FreeNodes;
+        }
+        else
+        {
+            Pool->FreeNodes = From->FreeNodes;
+        }
+        Pool->LastFreeNode = From->LastFreeNode;
+    }
+
+    /* Nodes are handed out in order from a single chunk: keep the one with more unused nodes, the
+       unused nodes of the other one are left out until the chunks are released */
+    if((size_t)(From->UnusedEnd - From->Unused) > (size_t)(Pool->UnusedEnd - Pool->Unused))
+    {
+        Pool->Unused = From->Unused;
+        Pool->UnusedEnd = From->UnusedEnd;
+    }
+    Pool->LastCapacity = (From->LastCapacity > Pool->LastCapacity ? From->LastCapacity : Pool->LastCapacity);
+    Pool->NumFree += From->NumFree;
+    Pool->Capacity += From->Capacity;
+    Static_SetTrimPoint(Pool);
+
+    From->FreeNodes = NULL;
+    From->Unused = From->UnusedEnd = NULL;
+    From->NumFree = From->Capacity = 0;
+}
+
+static ListBool_t Static_CanShareNodes(List_t* List, List_t* Other)
+{
+    /* Nodes can only move between lists whose nodes have the same layout and come from the same allocator */
+    return ((List->Linkage == Other->Linkage) && (List->ElemSize == Other->ElemSize) &&
+            (List->Allocator.Alloc == Other->Allocator.Alloc) && (List->Allocator.Free == Other->Allocator.Free) &&
+            (List->Allocator.Ctx == Other->Allocator.Ctx)) ? LL_TRUE : LL_FALSE;
+}
+
+static void Static_LockGroups(void)
+{
+    /* Lists of one group may be used by different threads, so the groups are only changed under this
+       lock. It's held for a few pointer updates, the chunks are freed after it's released. */
+#if defined(__GNUC__) || defined(__clang__)
+    while(__atomic_exchange_n(&GroupLock, 1, __ATOMIC_ACQUIRE))
+    {
+    }
+#elif defined(_MSC_VER)
+    while(_InterlockedExchange(&GroupLock, 1))
+    {
+    }
+#endif
+}
+
+static void Static_UnlockGroups(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(&GroupLock, 0, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+    _InterlockedExchange(&GroupLock, 0);
+#endif
+}
+
+static ListPoolGroup_t* Static_GetRootGroup(ListPoolGroup_t* Group)
+{
+    while(Group->Parent)
+    {
+        Group = Group->Parent;
+    }
+    return Group;
+}
+
+static ListStatus_t Static_SharePool(List_t* Dest, List_t* Src)
+{
+    /* Nodes of Src are about to move to Dest: put both lists in one group and give it the chunks of Src,
+       so they stay allocated as long as any of the lists. This only allocates memory when neither list
+       is in a group yet. */
+    if(IS_NULL(Dest->PoolGroup) && IS_NULL(Src->PoolGroup))
+    {
+        ListPoolGroup_t* Group = Src->Allocator.Alloc(sizeof(ListPoolGroup_t), Src->Allocator.Ctx);
+        RETURN_LL_NOT_OK_IF(IS_NULL(Group));
+
+        Group->Parent = NULL;
+        Group->Chunks = Group->LastChunk = NULL;
+        Group->NumRefs = 2;
+        Dest->PoolGroup = Src->PoolGroup = Group;
+    }
+
+    Static_LockGroups();
+
+    if(IS_NULL(Dest->PoolGroup) || IS_NULL(Src->PoolGroup))
+    {
+        /* The list that has no group joins the other one's */
+        ListPoolGroup_t* Group = (Dest->PoolGroup ? Dest->PoolGroup : Src->PoolGroup);
+        Dest->PoolGroup = Src->PoolGroup = Group;
+        Group->NumRefs++;
+    }
+
+    ListPoolGroup_t* Root = Static_GetRootGroup(Dest->PoolGroup);
+    ListPoolGroup_t* SrcRoot = Static_GetRootGroup(Src->PoolGroup);
+
+    if(SrcRoot != Root)
+    {
+        /* Merge the groups, the lists of the group of Src don't have to be visited */
+        Static_AppendChunks(&Root->Chunks, &Root->LastChunk, &SrcRoot->Chunks, &SrcRoot->LastChunk);
+        SrcRoot->Parent = Root;
+        Root->NumRefs++;
+    }
+
+    Static_AppendChunks(&Root->Chunks, &Root->LastChunk, &Src->Pool.Chunks, &Src->Pool.LastChunk);
+    Src->Pool.Capacity = 0;
+
+    Static_UnlockGroups();
+    return LL_OK;
+}
+
+static void Static_LeavePoolGroup(List_t* List)
+{
+    /* The groups that nothing points to anymore are released, with the chunks of the root group if it's
+       one of them */
+    ListPoolGroup_t* Group = List->PoolGroup;
+    ListPoolGroup_t* Last = Group;
+    ListChunk_t* Chunks = NULL;
+
+    List->PoolGroup = NULL;
+    Static_LockGroups();
+
+    while(Last && (--Last->NumRefs == 0))
+    {
+        if(IS_NULL(Last->Parent))
+        {
+            Chunks = Last->Chunks;
+        }
+        Last = Last->Parent;
+    }
+
+    Static_UnlockGroups();
+
+    while(Group != Last)
+    {
+        ListPoolGroup_t* Parent = Group->Parent;
+        List->Allocator.Free(Group, List->Allocator.Ctx);
+        Group = Parent;
+    }
+    Static_FreeChunkChain(List, Chunks);
+}
+
+static void Static_FreePool(List_t* List)
+{
+    /* The nodes of the list that are in the chunks of its group are released with the group */
+    Static_FreeChunks(List, &List->Pool);
+
+    if(List->PoolGroup)
+    {
+        Static_LeavePoolGroup(List);
+    }
+}
+
+static void Static_ResetPool(List_t* List)
+{
+    /* All the nodes of the pool are free: keep the newest chunk and hand out its nodes from the start
+       again, release the other chunks */
+    ListPool_t* Pool = &List->Pool;
+    ListChunk_t* Newest = Pool->Chunks;
+
+    if(Newest)
+    {
+        Pool->Chunks = Newest->Next;
+        Static_FreeChunks(List, Pool);
+
+        Newest->Next = NULL;
+        Pool->Chunks = Pool->LastChunk = Newest;
+        Pool->Unused = (char*)Newest->Nodes;
+        Pool->UnusedEnd = Pool->Unused + Newest->Capacity * Pool->NodeSize;
+        Pool->Capacity = Newest->Capacity;
+        Static_SetTrimPoint(Pool);
+    }
+}
+
+static void Static_FreeAbsorbed(List_t* List)
+{
+    /* Release the lists merged into this one by LL_Concat, and the lists merged into them */
+    List_t* Iter = List->Absorbed;
+
+    while(Iter)
+    {
+        List_t* Next = Iter->NextAbsorbed;
+
+        if(Iter->Absorbed)
+        {
+            /* Go through the lists merged into Iter before the next one */
+            List_t* Last = Iter->Absorbed;
+            while(Last->NextAbsorbed)
+            {
+                Last = Last->NextAbsorbed;
+            }
+            Last->NextAbsorbed = Next;
+            Next = Iter->Absorbed;
+        }
+
+        List->Allocator.Free(Iter, List->Allocator.Ctx);
+        Iter = Next;
+    }
+
+    List->Absorbed = NULL;
+}
+
+static ListStatus_t Static_GetPrevNode(List_t* List, ListNode_t* Node, ListNode_t** Prev)
+{
+    if(List->Linkage == LL_DOUBLE)
+    {
+        *Prev = Node->Prev;
+        return LL_OK;
+    }
+
+    if((Node == List->Tail) && (List->Linkage == LL_XOR))
+    {
+        /* The tail has no next node, so its link is the address of its prev node */
+        *Prev = Node->Next;
+        return LL_OK;
+    }
+
+    /* Walk from the head, keeping track of the prev node */
+    ListNode_t* Iter = List->Head;
+    ListNode_t* IterPrev = NULL;
+
+    while(Iter && (Iter != Node))
+    {
+        ListNode_t* Next = Static_GetNextNode(List, Iter, IterPrev);
+        IterPrev = Iter;
+        Iter = Next;
+    }
+
+    *Prev = IterPrev;
+    return (Iter ? LL_OK : LL_NOT_OK);
+}
+
+static ListBool_t Static_IsDataEqual(List_t* List, void* NodeData, void* Data)
+{
+    /* Inline lists compare values, the others compare pointers */
+    if(List->ElemSize)
+    {
+        return (memcmp(NodeData, Data, List->ElemSize) == 0 ? LL_TRUE : LL_FALSE);
+    }
+
+    return (NodeData == Data ? LL_TRUE : LL_FALSE);
+}
+
+static void Static_SetNodeData(List_t* List, ListNode_t* Node, void* Data)
+{
+    if(List->ElemSize)
+    {
+        /* The value is copied to the end of the node */
+        Node->Data = (char*)Node + List->Pool.NodeSize - INLINE_SIZE(List->ElemSize);
+        memcpy(Node->Data, Data, List->ElemSize);
+    }
+    else
+    {
+        Node->Data = Data;
+    }
+}
+
+static unsigned int Static_FirstBit(uint32_t Mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_ctz(Mask);
+#else
+    unsigned int Bit = 0;
+    while(!(Mask & 1))
+    {
+        Mask >>= 1;
+        Bit++;
+    }
+    return Bit;
+#endif
+}
+
+static unsigned int Static_CountBits(uint32_t Mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned int)__builtin_popcount(Mask);
+#else
+    unsigned int Count = 0;
+    for(; Mask; Mask &= Mask - 1)
+    {
+        Count++;
+    }
+    return Count;
+#endif
+}
+
+static ListNode_t* Static_SearchNext(List_t* List, ListNode_t* Node, ListNode_t* Prev)
+{
+    /* Nodes added one after the other are mostly next to each other in their chunk, so the node
+       LL_PREFETCH_DISTANCE places further in memory is prefetched. It is only a hint, a wrong guess
+       costs a useless load. */
+    LL_PREFETCH((const void*)((uintptr_t)Node + (uintptr_t)LL_PREFETCH_DISTANCE * List->Pool.NodeSize));
+
+    if(List->Contiguous)
+    {
+        /* The next node is found by address, without waiting for the link of this one */
+        return (Node == List->Tail ? NULL : (ListNode_t*)((char*)Node + List->Pool.NodeSize));
+    }
+
+    return Static_GetNextNode(List, Node, Prev);
+}
+
+static void Static_GatherBatch(List_t* List, ListBatch_t* Batch, unsigned int Size, ListNode_t** Iter,
+                               ListNode_t** IterPrev)
+{
+    /* Copy the next nodes and their data pointers next to each other, so they can be compared at once */
+    Batch->Count = 0;
+
+    while(*Iter && (Batch->Count < Size))
+    {
+        ListNode_t* Node = *Iter;
+        Batch->Nodes[Batch->Count] = Node;
+        Batch->Data[Batch->Count] = Node->Data;
+        Batch->Count++;
+
+        *Iter = Static_SearchNext(List, Node, *IterPrev);
+        *IterPrev = Node;
+    }
+}
+
+static uint32_t Static_MatchScalar(void* const* BatchData, unsigned int Count, void* Data)
+{
+    uint32_t Matches = 0;
+
+    for(unsigned int i = 0; i < Count; i++)
+    {
+        Matches |= (uint32_t)(BatchData[i] == Data) << i;
+    }
+
+    return Matches;
+}
+
+#ifdef LL_HAVE_AVX2
+__attribute__((target("avx2")))
+static uint32_t Static_MatchAvx2(void* const* BatchData, unsigned int Count, void* Data)
+{
+    /* Compare 4 pointers at a time, then the remaining ones one by one */
+    __m256i Key = _mm256_set1_epi64x((long long)(uintptr_t)Data);
+    uint32_t Matches = 0;
+    unsigned int i = 0;
+
+    for(; i + 4 <= Count; i += 4)
+    {
+        __m256i Pointers = _mm256_loadu_si256((const __m256i*)&BatchData[i]);
+        __m256i Equal = _mm256_cmpeq_epi64(Pointers, Key);
+        Matches |= (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(Equal)) << i;
+    }
+
+    for(; i < Count; i++)
+    {
+        Matches |= (uint32_t)(BatchData[i] == Data) << i;
+    }
+
+    return Matches;
+}
+#endif
+
+#ifdef LL_HAVE_AVX2
+/* Resolved once when the program starts, instead of checking the processor on every batch */
+static ListMatchFn_t Static_MatchPointers = Static_MatchScalar;
+
+__attribute__((constructor))
+static void Static_SelectMatchFn(void)
+{
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+    {
+        Static_MatchPointers = Static_MatchAvx2;
+    }
+}
+#else
+#define Static_MatchPointers        Static_MatchScalar
+#endif
+
+static uint32_t Static_MatchBatch(List_t* List, ListBatch_t* Batch, void* Data)
+{
+    /* Returns a bit mask of the nodes of the batch that contain the data */
+    if(List->ElemSize)
+    {
+        uint32_t Matches = 0;
+        for(unsigned int i = 0; i < Batch->Count; i++)
+        {
+            Matches |= (uint32_t)Static_IsDataEqual(List, Batch->Data[i], Data) << i;
+        }
+        return Matches;
+    }
+
+    return Static_MatchPointers(Batch->Data, Batch->Count, Data);
+}
+
+static ListNode_t* Static_GetNodeByData(List_t* List, void* Data, ListNode_t** Prev)
+{
+    ListHashEntry_t* Entry = NULL;
+
+    List->LookupStats.NumLookups++;
+
+    /* Data that is not in the filter is not in the list */
+    RETURN_NULL_IF(List->BloomFilter && !Static_BloomMayContain(List->BloomFilter, Data));
+
+    if(List->HashIndex)
+    {
+        /* Data that is not in the index is not in the list */
+        Entry = Static_HashFind(List->HashIndex, Data);
+        RETURN_NULL_IF(IS_NULL(Entry));
+
+        if(Entry->Value)
+        {
+            /* Prev is only needed by callers that unlink or link nodes (NULL otherwise) */
+            if(Prev && (Static_GetPrevNode(List, Entry->Value, Prev) != LL_OK))
+            {
+                return NULL;
+            }
+            List->LookupStats.NumFound++;
+            return Entry->Value;
+        }
+    }
+
+    /* A single lookup stops at the first match, so the nodes are compared one by one instead of in
+       batches, which would load the nodes after it */
+    ListNode_t* Found = List->Head;
+    ListNode_t* FoundPrev = NULL;
+    unsigned int NumProbes = 1;
+
+    if(List->ElemSize)
+    {
+        while(Found && !Static_IsDataEqual(List, Found->Data, Data))
+        {
+            ListNode_t* Next = Static_SearchNext(List, Found, FoundPrev);
+            FoundPrev = Found;
+            Found = Next;
+            NumProbes++;
+        }
+    }
+    else
+    {
+        while(Found && (Found->Data != Data))
+        {
+            ListNode_t* Next = Static_SearchNext(List, Found, FoundPrev);
+            FoundPrev = Found;
+            Found = Next;
+            NumProbes++;
+        }
+    }
+
+    List->LookupStats.NumProbes += (Found ? NumProbes : NumProbes - 1);
+    List->LookupStats.NumFound += (Found ? 1 : 0);
+
+    if(Entry && Found && (Entry->Count == 1))
+    {
+        /* The data is in a single node again, remember it */
+        Entry->Value = Found;
+    }
+
+    if(Prev)
+    {
+        *Prev = FoundPrev;
+    }
+    return Found;
+}
+
+static ListNode_t* Static_GetNodeAt(List_t* List, unsigned int Index, ListNode_t** Prev)
+{
+    /* The index must be less than the count */
+    if(List->SkipIndex)
+    {
+        ListNode_t* Node = Static_SkipGetNodeAt(List, Index + 1);
+        *Prev = Node->Prev;
+        return Node;
+    }
+
+    if((List->Linkage == LL_DOUBLE) && (Index >= List->Count / 2))
+    {
+        /* Closer to the tail */
+        ListNode_t* Node = List->Tail;
+        for(unsigned int i = List->Count - 1; i > Index; i--)
+        {
+            Node = Node->Prev;
+        }
+        *Prev = Node->Prev;
+        return Node;
+    }
+
+    ListNode_t* Iter = List->Head;
+    ListNode_t* IterPrev = NULL;
+
+    for(unsigned int i = 0; i < Index; i++)
+    {
+        ListNode_t* Next = Static_GetNextNode(List, Iter, IterPrev);
+        IterPrev = Iter;
+        Iter = Next;
+    }
+
+    *Prev = IterPrev;
+    return Iter;
+}
+
+static ListBool_t Static_IsBeforeKey(List_t* List, void* NodeData, void* Key, ListBool_t OrEquivalent)
+{
+    int Result = List->Compare(NodeData, Key);
+    return ((Result < 0) || (OrEquivalent && (Result == 0)) ? LL_TRUE : LL_FALSE);
+}
+
+static ListNode_t* Static_GetNodeByKey(List_t* List, void* Key, ListBool_t After, ListNode_t** Prev)
+{
+    /* Returns the first node that doesn't come before Key (or after Key if After is set) in a sorted
+       list, NULL if there is none. Prev is the node before it in both cases. */
+    ListNode_t* IterPrev = NULL;
+    ListNode_t* Iter = List->Head;
+
+    if(List->SkipIndex)
+    {
+        /* Descend the levels of the position index, then finish on the list itself */
+        ListSkipTower_t* Tower = List->SkipIndex->Sentinel;
+
+        for(unsigned int Level = LL_SKIP_MAX_LEVEL; Level-- > 0; )
+        {
+            while(Tower->Links[Level].Next &&
+                  Static_IsBeforeKey(List, Tower->Links[Level].Next->Node->Data, Key, After))
+            {
+                Tower = Tower->Links[Level].Next;
+            }
+        }
+
+        if(Tower->Node)
+        {
+            IterPrev = Tower->Node;
+            Iter = Tower->Node->Next;
+        }
+    }
+
+    while(Iter && Static_IsBeforeKey(List, Iter->Data, Key, After))
+    {
+        ListNode_t* Next = Static_GetNextNode(List, Iter, IterPrev);
+        IterPrev = Iter;
+        Iter = Next;
+    }
+
+    *Prev = IterPrev;
+    return Iter;
+}
+
+static void Static_LinkChain(List_t* List, ListNode_t* First, ListNode_t* Last, ListNode_t* Prev, ListNode_t* Next)
+{
+    /* Link the chain of nodes from First to Last between Prev and Next, which are adjacent (or NULL at
+       the ends of the list). The chain is linked internally, its outer links are NULL. */
+    if(List->Linkage == LL_XOR)
+    {
+        First->Next = XOR_LINK(First->Next, Prev);
+        Last->Next = XOR_LINK(Last->Next, Next);
+
+        if(Prev)
+        {
+            /* Replace Next with First in the link of Prev */
+            Prev->Next = XOR_LINK(XOR_LINK(Prev->Next, Next), First);
+        }
+        if(Next)
+        {
+            /* Replace Prev with Last in the link of Next */
+            Next->Next = XOR_LINK(XOR_LINK(Next->Next, Prev), Last);
+        }
+    }
+    else
+    {
+        /* Fwd links */
+        Last->Next = Next;
+        if(Prev)
+        {
+            Prev->Next = First;
+        }
+
+        /* Bwd links */
+        if(List->Linkage == LL_DOUBLE)
+        {
+            First->Prev = Prev;
+            if(Next)
+            {
+                Next->Prev = Last;
+            }
+        }
+    }
+
+    /* A single node keeps the nodes consecutive in memory if it's right after the tail in memory, the
+       callers that link longer chains check them */
+    List->Contiguous = (List->Contiguous && (First == Last) && IS_NULL(Next) &&
+                        (IS_NULL(Prev) ||
+                         ((char*)Prev + List->Pool.NodeSize == (char*)First))) ? LL_TRUE : LL_FALSE;
+
+    /* Update list head and tail if applicable */
+    if(IS_NULL(Prev))
+    {
+        List->Head = First;
+    }
+    if(IS_NULL(Next))
+    {
+        List->Tail = Last;
+    }
+}
+
+static void Static_LinkNode(List_t* List, ListNode_t* Node, ListNode_t* Prev, ListNode_t* Next)
+{
+    /* Link the node between Prev and Next, which are adjacent (or NULL at the ends of the list) */
+    Node->Next = NULL;
+    Static_LinkChain(List, Node, Node, Prev, Next);
+
+    /* Update count, indexes */
+    List->Count++;
+
+    if(List->HashIndex)
+    {
+        Static_HashAdd(List, Node);
+    }
+    if(List->SkipIndex)
+    {
+        Static_SkipInsert(List, Node, Prev);
+    }
+    if(List->BloomFilter)
+    {
+        Static_BloomAdd(List->BloomFilter, Node->Data);
+    }
+}
+
+static void Static_UnlinkChain(List_t* List, ListNode_t* First, ListNode_t* Last, ListNode_t* Prev,
+                               ListNode_t* Next)
+{
+    /* Bypass the chain of nodes from First to Last, Prev and Next are its neighbours (or NULL at the
+       ends of the list). The links of the chain itself are left as they are. */
+    if(List->Linkage == LL_XOR)
+    {
+        if(Prev)
+        {
+            Prev->Next = XOR_LINK(XOR_LINK(Prev->Next, First), Next);
+        }
+        if(Next)
+        {
+            Next->Next = XOR_LINK(XOR_LINK(Next->Next, Last), Prev);
+        }
+    }
+    else
+    {
+        if(Prev)
+        {
+            Prev->Next = Next;
+        }
+        if(Next && (List->Linkage == LL_DOUBLE))
+        {
+            Next->Prev = Prev;
+        }
+    }
+
+    /* Update list head and tail if applicable */
+    if(IS_NULL(Prev))
+    {
+        List->Head = Next;
+    }
+    if(IS_NULL(Next))
+    {
+        List->Tail = Prev;
+    }
+
+    /* The nodes stay consecutive in memory if the chain was at one end of the list */
+    List->Contiguous = ((List->Contiguous && (IS_NULL(Prev) || IS_NULL(Next))) ||
+                        IS_NULL(List->Head)) ? LL_TRUE : LL_FALSE;
+}
+
+static void Static_UnlinkNode(List_t* List, ListNode_t* Node, ListNode_t* Prev, ListNode_t* Next)
+{
+    /* Bypass the node, Prev and Next are its neighbours (or NULL at the ends of the list) */
+    Static_UnlinkChain(List, Node, Node, Prev, Next);
+
+    /* Update count, indexes */
+    if(List->HashIndex)
+    {
+        Static_HashRemove(List, Node);
+    }
+    if(List->SkipIndex)
+    {
+        Static_SkipRemove(List, Node);
+    }
+    if(List->BloomFilter)
+    {
+        Static_BloomRemove(List->BloomFilter, Node->Data);
+    }
+    List->Count--;
+}
+
+static void Static_RemoveNode(List_t* List, ListNode_t* Node, ListNode_t* Prev, ListNode_t* Next)
+{
+    Static_UnlinkNode(List, Node, Prev, Next);
+    Static_FreeNode(List, Node);
+}
+
+static ListStatus_t Static_ReserveChain(List_t* List, unsigned int NumNodes, ListSkipTower_t*** Towers)
+{
+    /* Make room in the indexes for NumNodes nodes about to be linked: linking a chain can't fail */
+    *Towers = NULL;
+    if(NumNodes == 0)
+    {
+        return LL_OK;
+    }
+    RETURN_LL_NOT_OK_IF(Static_HashReserve(List, &List->HashIndex, List->Count + NumNodes) != LL_OK);
+    RETURN_LL_NOT_OK_IF(List->BloomFilter && (Static_BloomReserve(List, List->Count + NumNodes) != LL_OK));
+
+    if(List->SkipIndex)
+    {
+        *Towers = Static_SkipNewTowers(List, NumNodes);
+        RETURN_LL_NOT_OK_IF(IS_NULL(*Towers));
+    }
+
+    return LL_OK;
+}
+
+static void Static_IndexChain(List_t* List, ListNode_t* First, ListNode_t* Prev, unsigned int NumNodes,
+                              ListSkipTower_t** Towers)
+{
+    /* Add the NumNodes nodes linked from First (after Prev) to the indexes, with the towers given by
+       Static_ReserveChain */
+    if(List->HashIndex || List->SkipIndex || List->BloomFilter)
+    {
+        ListNode_t* Node = First;
+
+        for(unsigned int i = 0; i < NumNodes; i++)
+        {
+            ListNode_t* Next = Static_GetNextNode(List, Node, Prev);
+
+            if(List->HashIndex)
+            {
+                Static_HashAdd(List, Node);
+            }
+            if(List->SkipIndex)
+            {
+                Static_SkipInsertTower(List, Node, Prev, Towers[i]);
+            }
+            if(List->BloomFilter)
+            {
+                Static_BloomAdd(List->BloomFilter, Node->Data);
+            }
+
+            Prev = Node;
+            Node = Next;
+        }
+    }
+
+    if(Towers)
+    {
+        List->Allocator.Free(Towers, List->Allocator.Ctx);
+    }
+}
+
+static void Static_UnindexChain(List_t* List, ListNode_t* First, ListNode_t* Last, ListNode_t* Prev,
+                                unsigned int NumNodes)
+{
+    /* Remove the NumNodes nodes from First to Last (after Prev) from the indexes, while they are still
+       linked. The position index finds a node from the nodes before it, so it's done from the last
+       node back (only doubly linked lists have a position index). */
+    if(List->SkipIndex)
+    {
+        ListNode_t* Node = Last;
+
+        for(unsigned int i = 0; i < NumNodes; i++)
+        {
+            if(List->HashIndex)
+            {
+                Static_HashRemove(List, Node);
+            }
+            Static_SkipRemove(List, Node);
+            if(List->BloomFilter)
+            {
+                Static_BloomRemove(List->BloomFilter, Node->Data);
+            }
+            Node = Node->Prev;
+        }
+    }
+    else if(List->HashIndex || List->BloomFilter)
+    {
+        ListNode_t* Node = First;
+
+        for(unsigned int i = 0; i < NumNodes; i++)
+        {
+            ListNode_t* Next = Static_GetNextNode(List, Node, Prev);
+
+            if(List->HashIndex)
+            {
+                Static_HashRemove(List, Node);
+            }
+            if(List->BloomFilter)
+            {
+                Static_BloomRemove(List->BloomFilter, Node->Data);
+            }
+
+            Prev = Node;
+            Node = Next;
+        }
+    }
+}
+
+static void Static_ReorderFoundNode(List_t* List, ListNode_t* Node, ListNode_t* Prev)
+{
+    /* Move a node found by a lookup towards the head, according to the lookup policy */
+    ListNode_t* NewPrev = NULL;
+    ListNode_t* NewNext = List->Head;
+
+    if(IS_NULL(Prev))
+    {
+        return;
+    }
+
+    if(List->LookupPolicy == LL_LOOKUP_TRANSPOSE)
+    {
+        /* Swap the node with its prev node */
+        NewNext = Prev;
+        if(List->Linkage == LL_XOR)
+        {
+            NewPrev = XOR_LINK(Prev->Next, Node);
+        }
+        else if(Static_GetPrevNode(List, Prev, &NewPrev) != LL_OK)
+        {
+            return;
+        }
+    }
+
+    /* Relinking can't fail, but it takes a spare tower from the position index */
+    if(List->SkipIndex && (Static_SkipReserve(List) != LL_OK))
+    {
+        return;
+    }
+
+    Static_UnlinkNode(List, Node, Prev, Static_GetNextNode(List, Node, Prev));
+    Static_LinkNode(List, Node, NewPrev, NewNext);
+}
+
+static List_t* Static_NewList(ListLinkage_t Linkage, size_t ElemSize, ListAllocFn_t Alloc, ListFreeFn_t Free,
+                              void* Ctx)
+{
+    List_t* List = NULL;
+    RETURN_NULL_IF(IS_NULL(Alloc) || IS_NULL(Free));
+
+    if((Linkage == LL_SINGLE || Linkage == LL_DOUBLE || Linkage == LL_XOR) && (List = Alloc(sizeof(List_t), Ctx)))
+    {
+        List->Head = NULL;
+        List->Tail = NULL;
+        List->Count = 0;
+        List->Contiguous = LL_TRUE;
+        List->Linkage = Linkage;
+        List->ElemSize = ElemSize;
+        List->Compare = NULL;
+        List->LookupPolicy = LL_LOOKUP_PLAIN;
+        List->LookupStats.NumLookups = List->LookupStats.NumFound = List->LookupStats.NumProbes = 0;
+        List->HashIndex = NULL;
+        List->SkipIndex = NULL;
+        List->BloomFilter = NULL;
+        List->Pool.Chunks = NULL;
+        List->Pool.FreeNodes = NULL;
+        List->Pool.Unused = List->Pool.UnusedEnd = NULL;
+        List->Pool.NodeSize = (Linkage == LL_DOUBLE ? sizeof(ListNode_t) : offsetof(ListNode_t, Prev));
+        List->Pool.LastCapacity = 0;
+        List->Pool.NumFree = List->Pool.Capacity = 0;
+        List->Pool.TrimAt = LL_POOL_TRIM_MIN_FREE;
+        List->PoolGroup = NULL;
+        List->NumRefs = List->NumForwarded = 0;
+        List->Forward = NULL;
+        List->Absorbed = NULL;
+        List->PrevAbsorbed = NULL;
+        List->NextAbsorbed = NULL;
+        List->Allocator.Alloc = Alloc;
+        List->Allocator.Free = Free;
+        List->Allocator.Ctx = Ctx;
+
+        if(ElemSize)
+        {
+            /* Room for an aligned value after the node fields */
+            List->Pool.NodeSize = INLINE_SIZE(List->Pool.NodeSize) + INLINE_SIZE(ElemSize);
+        }
+    }
+
+    return List;
+}
+
+List_t* LL_NewList(ListLinkage_t Linkage)
+{
+    return Static_NewList(Linkage, 0, Static_DefaultAlloc, Static_DefaultFree, NULL);
+}
+
+
+List_t* LL_NewListWithAllocator(ListLinkage_t Linkage, ListAllocFn_t Alloc, ListFreeFn_t Free, void* Ctx)
+{
+    return Static_NewList(Linkage, 0, Alloc, Free, Ctx);
+}
+
+
+List_t* LL_NewInlineList(ListLinkage_t Linkage, size_t ElemSize)
+{
+    RETURN_NULL_IF(ElemSize == 0);
+    return Static_NewList(Linkage, ElemSize, Static_DefaultAlloc, Static_DefaultFree, NULL);
+}
+
+
+List_t* LL_NewSortedList(ListLinkage_t Linkage, ListCompareFn_t Compare)
+{
+    RETURN_NULL_IF(IS_NULL(Compare));
+
+    List_t* List = Static_NewList(Linkage, 0, Static_DefaultAlloc, Static_DefaultFree, NULL);
+    RETURN_NULL_IF(IS_NULL(List));
+
+    /* The towers of the position index are the skip levels of the ordered search */
+    if((Linkage == LL_DOUBLE) && (LL_EnablePositionIndex(List) != LL_OK))
+    {
+        LL_DeleteList(List);
+        return NULL;
+    }
+
+    List->Compare = Compare;
+    return List;
+}
+
+
+ListNode_t* LL_GetHead(List_t* List)
+{
+    return (List ? List->Head : NULL);
+}
+
+
+ListNode_t* LL_GetTail(List_t* List)
+{
+    return (List ? List->Tail : NULL);
+}
+
+
+ListNode_t* LL_GetNext(ListNode_t* Node)
+{
+    /* A merged list keeps its linkage, so the owner doesn't need to be followed to the end */
+    return ((Node && (Node->Owner->Linkage != LL_XOR)) ? Node->Next : NULL);
+}
+
+
+ListNode_t* LL_GetPrev(ListNode_t* Node)
+{
+    return ((Node && (Node->Owner->Linkage == LL_DOUBLE)) ? Node->Prev : NULL);
+}
+
+
+void* LL_GetData(ListNode_t* Node)
+{
+    return (Node ? Node->Data : NULL);
+}
+
+
+ListNode_t* LL_GetNodeByData(List_t* List, void* Data)
+{
+    RETURN_NULL_IF(IS_NULL(Data) || IS_INVALID_OR_EMPTY(List)); 
+
+    if(List->LookupPolicy == LL_LOOKUP_PLAIN)
+    {
+        return Static_GetNodeByData(List, Data, NULL);
+    }
+
+    ListNode_t* Prev;
+    ListNode_t* Node = Static_GetNodeByData(List, Data, &Prev);
+    if(Node)
+    {
+        Static_ReorderFoundNode(List, Node, Prev);
+    }
+
+    return Node;
+}
+
+ListStatus_t LL_FindAll(List_t* List, void* Data, ListNode_t** Nodes, unsigned int MaxNodes,
+                        unsigned int* NumNodes)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_NULL(Nodes) || IS_NULL(NumNodes));
+    *NumNodes = 0;
+
+    if(List->BloomFilter && !Static_BloomMayContain(List->BloomFilter, Data))
+    {
+        return LL_OK;
+    }
+
+    ListNode_t* Iter = List->Head;
+    ListNode_t* IterPrev = NULL;
+    unsigned int Size = LL_SEARCH_FIRST_BATCH;
+    unsigned int Found = 0;
+    ListBatch_t Batch;
+
+    while(Iter && (Found < MaxNodes))
+    {
+        Static_GatherBatch(List, &Batch, Size, &Iter, &IterPrev);
+
+        for(uint32_t Matches = Static_MatchBatch(List, &Batch, Data);
+            Matches && (Found < MaxNodes); Matches &= Matches - 1)
+        {
+            Nodes[Found++] = Batch.Nodes[Static_FirstBit(Matches)];
+        }
+
+        Size = (Size < LL_SEARCH_MAX_BATCH ? Size * 2 : Size);
+    }
+
+    *NumNodes = Found;
+    return LL_OK;
+}
+
+ListStatus_t LL_CountMatches(List_t* List, void* Data, unsigned int* Count)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_NULL(Count));
+    *Count = 0;
+
+    if(List->BloomFilter && !Static_BloomMayContain(List->BloomFilter, Data))
+    {
+        return LL_OK;
+    }
+
+    if(List->HashIndex)
+    {
+        /* The index counts the nodes of each data pointer */
+        ListHashEntry_t* Entry = Static_HashFind(List->HashIndex, Data);
+        *Count = (Entry ? Entry->Count : 0);
+        return LL_OK;
+    }
+
+    ListNode_t* Iter = List->Head;
+    ListNode_t* IterPrev = NULL;
+    unsigned int Found = 0;
+    ListBatch_t Batch;
+
+    while(Iter)
+    {
+        Static_GatherBatch(List, &Batch, LL_SEARCH_MAX_BATCH, &Iter, &IterPrev);
+        Found += Static_CountBits(Static_MatchBatch(List, &Batch, Data));
+    }
+
+    *Count = Found;
+    return LL_OK;
+}
+
+ListStatus_t LL_AddToFront(List_t* List, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_SORTED(List));
+
+    ListNode_t* Node = Static_NewNode(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    Static_SetNodeData(List, Node, Data);
+    Static_LinkNode(List, Node, NULL, List->Head);
+
+    return LL_OK;
+}
+
+
+ListStatus_t LL_AddToBack(List_t* List, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_SORTED(List));
+
+    ListNode_t* Node = Static_NewNode(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    Static_SetNodeData(List, Node, Data);
+    Static_LinkNode(List, Node, List->Tail, NULL);
+
+    return LL_OK;
+}
+
+
+static ListStatus_t Static_AddArray(List_t* List, void* const* Data, unsigned int NumData, ListNode_t* Prev,
+                                    ListNode_t* Next)
+{
+    /* Everything that can fail is done before the list is changed */
+    ListSkipTower_t** Towers = NULL;
+    RETURN_LL_NOT_OK_IF(Static_ReserveNodes(List, NumData) != LL_OK);
+    RETURN_LL_NOT_OK_IF(Static_ReserveChain(List, NumData, &Towers) != LL_OK);
+
+    /* Take consecutive nodes from the pool and link them to each other in one pass */
+    ListPool_t* Pool = &List->Pool;
+    ListNode_t* First = (ListNode_t*)Pool->Unused;
+    ListNode_t* Last = NULL;
+
+    for(unsigned int i = 0; i < NumData; i++)
+    {
+        ListNode_t* Node = (ListNode_t*)Pool->Unused;
+        ListNode_t* After = (i + 1 < NumData ? (ListNode_t*)(Pool->Unused + Pool->NodeSize) : NULL);
+        Pool->Unused += Pool->NodeSize;
+
+        Node->Owner = List;
+        Node->Next = (List->Linkage == LL_XOR ? XOR_LINK(Last, After) : After);
+        if(List->Linkage == LL_DOUBLE)
+        {
+            Node->Prev = Last;
+        }
+        Static_SetNodeData(List, Node, Data[i]);
+        Last = Node;
+    }
+
+    /* Splice the chain in at once. The chain is consecutive in memory, so it keeps the list consecutive
+       at its back. */
+    ListBool_t Contiguous = List->Contiguous;
+    Static_LinkChain(List, First, Last, Prev, Next);
+    List->Contiguous = (Contiguous && IS_NULL(Next) &&
+                        (IS_NULL(Prev) || ((char*)Prev + Pool->NodeSize == (char*)First))) ? LL_TRUE : LL_FALSE;
+    List->Count += NumData;
+    Static_IndexChain(List, First, Prev, NumData, Towers);
+
+    return LL_OK;
+}
+
+ListStatus_t LL_AddArrayToFront(List_t* List, void* const* Data, unsigned int NumData)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_SORTED(List));
+
+    for(unsigned int i = 0; i < NumData; i++)
+    {
+        RETURN_LL_NOT_OK_IF(IS_NULL(Data[i]));
+    }
+
+    return (NumData ? Static_AddArray(List, Data, NumData, NULL, List->Head) : LL_OK);
+}
+
+ListStatus_t LL_AddArrayToBack(List_t* List, void* const* Data, unsigned int NumData)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_SORTED(List));
+
+    for(unsigned int i = 0; i < NumData; i++)
+    {
+        RETURN_LL_NOT_OK_IF(IS_NULL(Data[i]));
+    }
+
+    return (NumData ? Static_AddArray(List, Data, NumData, List->Tail, NULL) : LL_OK);
+}
+
+ListStatus_t LL_InsertAfterNode(ListNode_t* Node, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node) || IS_NULL(Data));
+
+    List_t* List = Static_ClaimNode(Node);
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List) || IS_SORTED(List));
+
+    ListNode_t* Next = Node->Next;
+
+    if(List->Linkage == LL_XOR)
+    {
+        /* The next node can only be found from the prev node */
+        ListNode_t* Prev;
+        RETURN_LL_NOT_OK_IF(Static_GetPrevNode(List, Node, &Prev) != LL_OK);
+        Next = XOR_LINK(Node->Next, Prev);
+    }
+   
+    ListNode_t* NewNode = Static_NewNode(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(NewNode));
+
+    Static_SetNodeData(List, NewNode, Data);
+    Static_LinkNode(List, NewNode, Node, Next);
+
+    return LL_OK;
+}
+
+ListStatus_t LL_SetData(ListNode_t* Node, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node) || IS_NULL(Data));
+
+    List_t* List = Static_ClaimNode(Node);
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List) || IS_SORTED(List));
+
+    /* Re-key the node, removing its hash entry first guarantees there is room for the new one */
+    if(List->HashIndex)
+    {
+        Static_HashRemove(List, Node);
+    }
+    if(List->BloomFilter)
+    {
+        Static_BloomRemove(List->BloomFilter, Node->Data);
+    }
+
+    Static_SetNodeData(List, Node, Data);
+
+    if(List->HashIndex)
+    {
+        Static_HashAdd(List, Node);
+    }
+    if(List->BloomFilter)
+    {
+        Static_BloomAdd(List->BloomFilter, Node->Data);
+    }
+
+    return LL_OK;
+}
+
+ListStatus_t LL_InsertAfterData(List_t* List, void* ExistingData, void* NewData)
+{   
+    RETURN_LL_NOT_OK_IF(IS_NULL(ExistingData) || IS_NULL(NewData) || IS_INVALID_OR_EMPTY(List) || IS_SORTED(List));
+   
+    ListNode_t* Prev;
+    ListNode_t* Node = Static_GetNodeByData(List, ExistingData, &Prev);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    ListNode_t* NewNode = Static_NewNode(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(NewNode));
+
+    Static_SetNodeData(List, NewNode, NewData);
+    Static_LinkNode(List, NewNode, Node, Static_GetNextNode(List, Node, Prev));
+
+    return LL_OK;
+}
+
+ListStatus_t LL_RemoveHead(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
+
+    Static_RemoveNode(List, List->Head, NULL, Static_GetNextNode(List, List->Head, NULL));
+
+    return LL_OK;
+}
+
+ListStatus_t LL_RemoveTail(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
+
+    ListNode_t* Prev;
+    RETURN_LL_NOT_OK_IF(Static_GetPrevNode(List, List->Tail, &Prev) != LL_OK);
+    Static_RemoveNode(List, List->Tail, Prev, NULL);
+        
+    return LL_OK;
+}
+
+ListStatus_t LL_RemoveNode(ListNode_t* Node)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    List_t* List = Static_ClaimNode(Node);
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
+
+    if((List->Linkage == LL_SINGLE) && Node->Next)
+    {
+        /* The prev node can't be found without walking the list: Node takes the data of its next node
+           instead, and the next node is removed */
+        ListNode_t* Next = Node->Next;
+
+        if(List->HashIndex)
+        {
+            Static_HashRemove(List, Node);
+        }
+        if(List->BloomFilter)
+        {
+            Static_BloomRemove(List->BloomFilter, Node->Data);
+        }
+
+        Static_UnlinkNode(List, Next, Node, Next->Next);
+        Static_SetNodeData(List, Node, Next->Data);
+        Static_FreeNode(List, Next);
+
+        if(List->HashIndex)
+        {
+            Static_HashAdd(List, Node);
+        }
+        if(List->BloomFilter)
+        {
+            Static_BloomAdd(List->BloomFilter, Node->Data);
+        }
+
+        return LL_OK;
+    }
+
+    ListNode_t* Prev;
+    RETURN_LL_NOT_OK_IF(Static_GetPrevNode(List, Node, &Prev) != LL_OK);
+
+    Static_RemoveNode(List, Node, Prev, Static_GetNextNode(List, Node, Prev));
+    
+    return LL_OK;
+}
+
+ListStatus_t LL_RemoveAfterNode(ListNode_t* Node)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    List_t* List = Static_ClaimNode(Node);
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
+
+    ListNode_t* Prev = NULL;
+
+    /* Only XOR linked lists need the prev node to find the next one */
+    if(List->Linkage == LL_XOR)
+    {
+        RETURN_LL_NOT_OK_IF(Static_GetPrevNode(List, Node, &Prev) != LL_OK);
+    }
+
+    ListNode_t* Removed = Static_GetNextNode(List, Node, Prev);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Removed));
+
+    Static_RemoveNode(List, Removed, Node, Static_GetNextNode(List, Removed, Node));
+
+    return LL_OK;
+}
+
+ListStatus_t LL_RemoveNodeByData(List_t* List, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Data) || IS_INVALID_OR_EMPTY(List));
+
+    ListNode_t* Prev;
+    ListNode_t* Node = Static_GetNodeByData(List, Data, &Prev);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    Static_RemoveNode(List, Node, Prev, Static_GetNextNode(List, Node, Prev));
+
+    return LL_OK;
+}
+
+static void Static_MoveReservedChain(List_t* Src, ListNode_t* First, ListNode_t* Last, ListNode_t* Prev,
+                                     ListNode_t* Next, unsigned int NumNodes, List_t* Dest, ListNode_t* After,
+                                     ListSkipTower_t** Towers)
+{
+    /* Move the NumNodes nodes from First to Last (between Prev and Next in Src) after the node After of
+       Dest, or to its front if After is NULL. The lists share their chunks already and the indexes of
+       Dest have room for the nodes (see Static_ReserveChain), so this can't fail. */
+
+    /* Take the chain out of Src, its outer links become NULL */
+    Static_UnindexChain(Src, First, Last, Prev, NumNodes);
+    Static_UnlinkChain(Src, First, Last, Prev, Next);
+    Src->Count -= NumNodes;
+
+    if(Src->Linkage == LL_XOR)
+    {
+        First->Next = XOR_LINK(First->Next, Prev);
+        Last->Next = XOR_LINK(Last->Next, Next);
+    }
+
+    if(Dest != Src)
+    {
+        ListNode_t* Iter = First;
+        ListNode_t* IterPrev = NULL;
+
+        for(unsigned int i = 0; i < NumNodes; i++)
+        {
+            ListNode_t* IterNext = Static_GetNextNode(Dest, Iter, IterPrev);
+            Static_DisownNode(Src, Iter);
+            Iter->Owner = Dest;
+            IterPrev = Iter;
+            Iter = IterNext;
+        }
+    }
+
+    /* The node after After is only known now, since it may have been Prev's next node */
+    Next = Dest->Head;
+    if(After)
+    {
+        ListNode_t* AfterPrev = NULL;
+        if(Dest->Linkage == LL_XOR)
+        {
+            Static_GetPrevNode(Dest, After, &AfterPrev);
+        }
+        Next = Static_GetNextNode(Dest, After, AfterPrev);
+    }
+
+    Static_LinkChain(Dest, First, Last, After, Next);
+    Dest->Count += NumNodes;
+    Static_IndexChain(Dest, First, After, NumNodes, Towers);
+}
+
+static ListStatus_t Static_MoveChain(List_t* Src, ListNode_t* First, ListNode_t* Last, ListNode_t* Prev,
+                                     ListNode_t* Next, unsigned int NumNodes, List_t* Dest, ListNode_t* After)
+{
+    /* Everything that can fail is done before the lists are changed */
+    ListSkipTower_t** Towers = NULL;
+    RETURN_LL_NOT_OK_IF((Dest != Src) && (Static_SharePool(Dest, Src) != LL_OK));
+    RETURN_LL_NOT_OK_IF(Static_ReserveChain(Dest, NumNodes, &Towers) != LL_OK);
+
+    Static_MoveReservedChain(Src, First, Last, Prev, Next, NumNodes, Dest, After, Towers);
+    return LL_OK;
+}
+
+static void Static_AbsorbList(List_t* Dest, List_t* Src)
+{
+    /* Dest takes the pool of Src, whose nodes are linked into Dest by the caller. The nodes of Src still
+       refer to it: Src forwards them to Dest and stays allocated until none of them refers to it (see
+       Static_ReleaseOwner) or Dest is cleared or deleted. */
+    Static_AbsorbPool(&Dest->Pool, &Src->Pool);
+
+    if(Src->PoolGroup)
+    {
+        /* Other lists have nodes in the chunks of the group of Src, Dest takes its place in the group.
+           This doesn't allocate memory, since Src is already in a group. */
+        Static_SharePool(Dest, Src);
+        Static_LeavePoolGroup(Src);
+    }
+
+    Static_FreeHashIndex(Src);
+    Static_FreeSkipIndex(Src);
+    Static_FreeBloomFilter(Src);
+
+    /* All the nodes of Src now refer to lists merged into Dest */
+    Src->NumRefs += Src->Count - Src->NumForwarded;
+    Dest->NumForwarded += Src->Count;
+    Dest->NumRefs++;
+    Src->Head = Src->Tail = NULL;
+    Src->Count = 0;
+    Src->NumForwarded = 0;
+    Src->Forward = Dest;
+    Src->PrevAbsorbed = NULL;
+    Src->NextAbsorbed = Dest->Absorbed;
+    if(Dest->Absorbed)
+    {
+        Dest->Absorbed->PrevAbsorbed = Src;
+    }
+    Dest->Absorbed = Src;
+}
+
+ListStatus_t LL_Concat(List_t* Dest, List_t* Src)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Dest) || IS_NULL(Src) || (Dest == Src) || IS_SORTED(Dest) ||
+                        !Static_CanShareNodes(Dest, Src));
+
+    if(IS_EMPTY(Src))
+    {
+        return LL_DeleteList(Src);
+    }
+
+    /* Everything that can fail is done before the lists are changed */
+    ListSkipTower_t** Towers = NULL;
+    RETURN_LL_NOT_OK_IF(Static_ReserveChain(Dest, Src->Count, &Towers) != LL_OK);
+
+    ListNode_t* First = Src->Head;
+    ListNode_t* Last = Src->Tail;
+    unsigned int NumNodes = Src->Count;
+    Static_AbsorbList(Dest, Src);
+
+    /* The outer links of the chain of Src are already NULL */
+    ListNode_t* Prev = Dest->Tail;
+    Static_LinkChain(Dest, First, Last, Prev, NULL);
+    Dest->Count += NumNodes;
+    Static_IndexChain(Dest, First, Prev, NumNodes, Towers);
+
+    return LL_OK;
+}
+
+ListStatus_t LL_Splice(List_t* Dest, ListNode_t* After, ListNode_t* First, ListNode_t* Last)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Dest) || IS_NULL(First) || IS_NULL(Last) || IS_SORTED(Dest));
+
+    List_t* Src = Static_GetOwner(First);
+    RETURN_LL_NOT_OK_IF((Static_GetOwner(Last) != Src) || (After && (Static_GetOwner(After) != Dest)) ||
+                        !Static_CanShareNodes(Dest, Src));
+
+    /* Find the neighbours of the chain and count its nodes, After must not be one of them */
+    ListNode_t* Prev;
+    RETURN_LL_NOT_OK_IF(Static_GetPrevNode(Src, First, &Prev) != LL_OK);
+
+    ListNode_t* Iter = First;
+    ListNode_t* IterPrev = Prev;
+    unsigned int NumNodes = 1;
+
+    while(Iter != Last)
+    {
+        RETURN_LL_NOT_OK_IF(Iter == After);
+
+        ListNode_t* IterNext = Static_GetNextNode(Src, Iter, IterPrev);
+        IterPrev = Iter;
+        Iter = IterNext;
+        NumNodes++;
+
+        /* Last comes before First */
+        RETURN_LL_NOT_OK_IF(IS_NULL(Iter));
+    }
+    RETURN_LL_NOT_OK_IF(Last == After);
+
+    return Static_MoveChain(Src, First, Last, Prev, Static_GetNextNode(Src, Last, IterPrev), NumNodes, Dest,
+                            After);
+}
+
+static List_t* Static_NewPart(List_t* List)
+{
+    /* New list that takes nodes of List: same kind of nodes, same allocator, same order. Only the
+       position index is kept, for sorted lists, whose ordered search goes through it. */
+    List_t* Part = Static_NewList(List->Linkage, List->ElemSize, List->Allocator.Alloc, List->Allocator.Free,
+                                  List->Allocator.Ctx);
+    RETURN_NULL_IF(IS_NULL(Part));
+
+    if(IS_SORTED(List) && List->SkipIndex && (LL_EnablePositionIndex(Part) != LL_OK))
+    {
+        LL_DeleteList(Part);
+        return NULL;
+    }
+
+    Part->Compare = List->Compare;
+    Part->LookupPolicy = List->LookupPolicy;
+    return Part;
+}
+
+ListStatus_t LL_SplitAfter(ListNode_t* Node, List_t** NewList)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node) || IS_NULL(NewList));
+
+    List_t* List = Static_ClaimNode(Node);
+    ListNode_t* Prev = NULL;
+    RETURN_LL_NOT_OK_IF((List->Linkage == LL_XOR) && (Static_GetPrevNode(List, Node, &Prev) != LL_OK));
+
+    List_t* Part = Static_NewPart(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Part));
+
+    /* Count the nodes after Node */
+    ListNode_t* First = Static_GetNextNode(List, Node, Prev);
+    ListNode_t* Iter = First;
+    ListNode_t* IterPrev = Node;
+    unsigned int NumNodes = 0;
+
+    while(Iter)
+    {
+        ListNode_t* IterNext = Static_GetNextNode(List, Iter, IterPrev);
+        IterPrev = Iter;
+        Iter = IterNext;
+        NumNodes++;
+    }
+
+    if(First && (Static_MoveChain(List, First, List->Tail, Node, NULL, NumNodes, Part, NULL) != LL_OK))
+    {
+        LL_DeleteList(Part);
+        return LL_NOT_OK;
+    }
+
+    *NewList = Part;
+    return LL_OK;
+}
+
+ListStatus_t LL_SplitInto(List_t* List, unsigned int NumLists, List_t** Lists)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Lists) || (NumLists == 0));
+
+    unsigned int PartSize = List->Count / NumLists;
+    unsigned int NumBigger = List->Count % NumLists;
+    ListSkipTower_t*** Towers = NULL;
+    unsigned int NumReady = 1;
+
+    /* Create the lists, make them share the chunks of List and make room in their indexes first: then
+       moving the nodes can't fail */
+    if(IS_SORTED(List) && List->SkipIndex && (NumLists > 1))
+    {
+        Towers = List->Allocator.Alloc(NumLists * sizeof(ListSkipTower_t**), List->Allocator.Ctx);
+        RETURN_LL_NOT_OK_IF(IS_NULL(Towers));
+    }
+
+    for(; NumReady < NumLists; NumReady++)
+    {
+        List_t* Part = Static_NewPart(List);
+
+        if(Part && ((Static_SharePool(Part, List) != LL_OK) ||
+                    (Towers &&
+                     (Static_ReserveChain(Part, PartSize + (NumReady < NumBigger), &Towers[NumReady]) != LL_OK))))
+        {
+            LL_DeleteList(Part);
+            Part = NULL;
+        }
+        if(IS_NULL(Part))
+        {
+            break;
+        }
+
+        Lists[NumReady] = Part;
+    }
+
+    if(NumReady < NumLists)
+    {
+        while(--NumReady > 0)
+        {
+            if(Towers)
+            {
+                Static_SkipFreeTowers(Lists[NumReady], Towers[NumReady], PartSize + (NumReady < NumBigger));
+            }
+            LL_DeleteList(Lists[NumReady]);
+        }
+        if(Towers)
+        {
+            List->Allocator.Free(Towers, List->Allocator.Ctx);
+        }
+        return LL_NOT_OK;
+    }
+    Lists[0] = List;
+
+    /* The first part stays in List, walk past it */
+    ListNode_t* Keep = NULL;
+    ListNode_t* Iter = List->Head;
+
+    for(unsigned int n = PartSize + (NumBigger > 0); n > 0; n--)
+    {
+        ListNode_t* IterNext = Static_GetNextNode(List, Iter, Keep);
+        Keep = Iter;
+        Iter = IterNext;
+    }
+
+    /* Every other part follows the last kept node when it's moved */
+    for(unsigned int i = 1; (i < NumLists) && Iter; i++)
+    {
+        unsigned int NumNodes = PartSize + (i < NumBigger);
+        ListNode_t* First = Iter;
+        ListNode_t* Last = Iter;
+        ListNode_t* LastPrev = Keep;
+
+        for(unsigned int n = 1; n < NumNodes; n++)
+        {
+            ListNode_t* LastNext = Static_GetNextNode(List, Last, LastPrev);
+            LastPrev = Last;
+            Last = LastNext;
+        }
+
+        Iter = Static_GetNextNode(List, Last, LastPrev);
+        Static_MoveReservedChain(List, First, Last, Keep, Iter, NumNodes, Lists[i], NULL,
+                                 (Towers ? Towers[i] : NULL));
+    }
+
+    if(Towers)
+    {
+        List->Allocator.Free(Towers, List->Allocator.Ctx);
+    }
+    return LL_OK;
+}
+
+ListStatus_t LL_GetCount(List_t* List, unsigned int* Count)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Count));
+    *Count = List->Count;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_Insert(List_t* List, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || !IS_SORTED(List));
+
+    ListNode_t* Prev;
+    ListNode_t* Next = Static_GetNodeByKey(List, Data, LL_TRUE, &Prev);
+
+    ListNode_t* Node = Static_NewNode(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    Static_SetNodeData(List, Node, Data);
+    Static_LinkNode(List, Node, Prev, Next);
+
+    return LL_OK;
+}
+
+ListNode_t* LL_Find(List_t* List, void* Key)
+{
+    ListNode_t* Node = LL_LowerBound(List, Key);
+    return ((Node && (List->Compare(Node->Data, Key) == 0)) ? Node : NULL);
+}
+
+ListNode_t* LL_LowerBound(List_t* List, void* Key)
+{
+    RETURN_NULL_IF(IS_NULL(Key) || IS_INVALID_OR_EMPTY(List) || !IS_SORTED(List));
+
+    ListNode_t* Prev;
+    return Static_GetNodeByKey(List, Key, LL_FALSE, &Prev);
+}
+
+static ListNode_t* Static_MergeRuns(ListNode_t* A, ListNode_t* B, ListCompareFn_t Compare)
+{
+    /* Merge two sorted chains linked through their Next fields (NULL at the end). The nodes of A come
+       first when the data is equivalent, which keeps the sort stable. */
+    ListNode_t* Head = NULL;
+    ListNode_t** Link = &Head;
+
+    while(A && B)
+    {
+        if(Compare(B->Data, A->Data) < 0)
+        {
+            *Link = B;
+            Link = &B->Next;
+            B = B->Next;
+        }
+        else
+        {
+            *Link = A;
+            Link = &A->Next;
+            A = A->Next;
+        }
+    }
+
+    *Link = (A ? A : B);
+    return Head;
+}
+
+static ListNode_t* Static_SortChain(ListNode_t* Head, ListCompareFn_t Compare)
+{
+    /* Bottom-up merge sort of a chain linked through Next fields. Runs works like a binary counter:
+       Runs[i] is a sorted run of 2^i nodes or NULL, and each node taken from the chain is merged with
+       the runs it carries into. Runs[i] holds nodes that came before the ones of Runs[i - 1]. */
+    ListNode_t* Runs[LL_SORT_MAX_RUNS] = {NULL};
+    unsigned int i;
+
+    while(Head)
+    {
+        ListNode_t* Run = Head;
+        Head = Head->Next;
+        Run->Next = NULL;
+
+        for(i = 0; Runs[i] && (i < LL_SORT_MAX_RUNS - 1); i++)
+        {
+            Run = Static_MergeRuns(Runs[i], Run, Compare);
+            Runs[i] = NULL;
+        }
+        Runs[i] = (Runs[i] ? Static_MergeRuns(Runs[i], Run, Compare) : Run);
+    }
+
+    for(i = 0; i < LL_SORT_MAX_RUNS; i++)
+    {
+        if(Runs[i])
+        {
+            Head = Static_MergeRuns(Runs[i], Head, Compare);
+        }
+    }
+
+    return Head;
+}
+
+static void Static_SkipRetarget(List_t* List)
+{
+    /* The nodes were reordered: the towers stay at their positions and take the nodes that are now
+       there, so the index is rebuilt without allocating memory */
+    ListSkipIndex_t* Index = List->SkipIndex;
+    ListSkipTower_t* Tower = Index->Sentinel->Links[0].Next;
+    unsigned int Position = Index->Sentinel->Links[0].Span;
+    ListNode_t* Node = List->Head;
+    unsigned int NodePosition = 1;
+
+    Static_HashClear(Index->Towers);
+
+    while(Tower)
+    {
+        for(; NodePosition < Position; NodePosition++)
+        {
+            Node = Node->Next;
+        }
+
+        Tower->Node = Node;
+        Static_HashInsertEntry(Index->Towers, Node)->Value = Tower;
+        Position += Tower->Links[0].Span;
+        Tower = Tower->Links[0].Next;
+    }
+}
+
+static void Static_RestoreLinks(List_t* List, ListNode_t* Head)
+{
+    /* The nodes of the list were relinked through their Next fields only, from Head: rebuild the Prev
+       or XOR links, the tail, the position index and the memory layout flag */
+    ListNode_t* Node = Head;
+    ListNode_t* Prev = NULL;
+    ListBool_t Contiguous = LL_TRUE;
+
+    while(Node)
+    {
+        ListNode_t* Next = Node->Next;
+
+        if(List->Linkage == LL_DOUBLE)
+        {
+            Node->Prev = Prev;
+        }
+        else if(List->Linkage == LL_XOR)
+        {
+            Node->Next = XOR_LINK(Prev, Next);
+        }
+
+        Contiguous = (Contiguous &&
+                      (IS_NULL(Prev) || ((char*)Prev + List->Pool.NodeSize == (char*)Node))) ? LL_TRUE : LL_FALSE;
+        Prev = Node;
+        Node = Next;
+    }
+
+    List->Head = Head;
+    List->Tail = Prev;
+    List->Contiguous = Contiguous;
+
+    if(List->SkipIndex)
+    {
+        Static_SkipRetarget(List);
+    }
+}
+
+ListStatus_t LL_Sort(List_t* List, ListCompareFn_t Compare)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Compare) || IS_SORTED(List));
+
+    if(List->Count < 2)
+    {
+        return LL_OK;
+    }
+
+    if(List->Linkage == LL_XOR)
+    {
+        Static_UnXorLinks(List);
+    }
+
+    /* The hash index and the Bloom filter don't depend on the order of the nodes */
+    Static_RestoreLinks(List, Static_SortChain(List->Head, Compare));
+
+    return LL_OK;
+}
+
+ListStatus_t LL_Reverse(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_SORTED(List));
+
+    if(List->Count < 2)
+    {
+        return LL_OK;
+    }
+
+    if(List->Linkage == LL_XOR)
+    {
+        /* XOR links read the same from both ends */
+        ListNode_t* Head = List->Head;
+        List->Head = List->Tail;
+        List->Tail = Head;
+        List->Contiguous = LL_FALSE;
+        return LL_OK;
+    }
+
+    /* Turn the Next links around, then rebuild the rest like after a sort */
+    ListNode_t* Node = List->Head;
+    ListNode_t* Prev = NULL;
+
+    while(Node)
+    {
+        ListNode_t* Next = Node->Next;
+        Node->Next = Prev;
+        Prev = Node;
+        Node = Next;
+    }
+    Static_RestoreLinks(List, Prev);
+
+    return LL_OK;
+}
+
+static ListBool_t Static_MergeBefore(ListMergeEntry_t* A, ListMergeEntry_t* B, ListCompareFn_t Compare)
+{
+    int Order = Compare(A->Node->Data, B->Node->Data);
+    return ((Order < 0) || ((Order == 0) && (A->Source < B->Source))) ? LL_TRUE : LL_FALSE;
+}
+
+static void Static_MergeSiftDown(ListMergeEntry_t* Heap, unsigned int Size, unsigned int i,
+                                 ListCompareFn_t Compare)
+{
+    ListMergeEntry_t Entry = Heap[i];
+
+    for(unsigned int Child = 2 * i + 1; Child < Size; Child = 2 * i + 1)
+    {
+        if((Child + 1 < Size) && Static_MergeBefore(&Heap[Child + 1], &Heap[Child], Compare))
+        {
+            Child++;
+        }
+        if(!Static_MergeBefore(&Heap[Child], &Entry, Compare))
+        {
+            break;
+        }
+        Heap[i] = Heap[Child];
+        i = Child;
+    }
+
+    Heap[i] = Entry;
+}
+
+static ListNode_t* Static_MergeChains(List_t* List, ListNode_t** Heads, unsigned int NumChains,
+                                      ListCompareFn_t Compare, ListNode_t** Tail, ListBool_t* Contiguous)
+{
+    /* k-way merge of at most LL_MERGE_MAX_CHAINS sorted chains linked through their Next fields (NULL
+       at the end), some of which may be empty. A heap holds the first node of each chain; nodes of the
+       chains that come first in Heads win on equivalent data, which keeps the merge stable. The merged
+       nodes are linked like the nodes of List, from a NULL prev to a NULL next, and Contiguous tells
+       whether they are consecutive in memory. If List is NULL, they are only linked through their Next
+       fields. */
+    ListMergeEntry_t Heap[LL_MERGE_MAX_CHAINS];
+    unsigned int Size = 0;
+    ListNode_t* Head = NULL;
+    ListNode_t* Last = NULL;
+    ListNode_t* LastPrev = NULL;
+
+    for(unsigned int i = 0; i < NumChains; i++)
+    {
+        if(Heads[i])
+        {
+            Heap[Size].Node = Heads[i];
+            Heap[Size].Source = i;
+            Size++;
+        }
+    }
+    for(unsigned int i = Size / 2; i-- > 0; )
+    {
+        Static_MergeSiftDown(Heap, Size, i, Compare);
+    }
+
+    *Contiguous = LL_TRUE;
+
+    while(Size > 0)
+    {
+        ListNode_t* Node = Heap[0].Node;
+
+        if(Node->Next)
+        {
+            Heap[0].Node = Node->Next;
+        }
+        else
+        {
+            Heap[0] = Heap[--Size];
+        }
+        Static_MergeSiftDown(Heap, Size, 0, Compare);
+
+        /* The next node of Last is known now */
+        if(IS_NULL(Last))
+        {
+            Head = Node;
+        }
+        else if(IS_NULL(List))
+        {
+            Last->Next = Node;
+        }
+        else
+        {
+            Last->Next = (List->Linkage == LL_XOR ? XOR_LINK(LastPrev, Node) : Node);
+            if((char*)Last + List->Pool.NodeSize != (char*)Node)
+            {
+                *Contiguous = LL_FALSE;
+            }
+        }
+        if(List && (List->Linkage == LL_DOUBLE))
+        {
+            Node->Prev = Last;
+        }
+
+        LastPrev = Last;
+        Last = Node;
+    }
+
+    if(Last)
+    {
+        Last->Next = ((List && (List->Linkage == LL_XOR)) ? LastPrev : NULL);
+    }
+
+    *Tail = Last;
+    return Head;
+}
+
+#ifdef LL_HAVE_THREADS
+static void Static_SortSamples(ListSortSample_t* Samples, ListSortSample_t* Temp, unsigned int Count,
+                               ListCompareFn_t Compare)
+{
+    /* Stable bottom-up merge sort, Temp has room for Count samples. The samples are taken in list order,
+       so samples with equal data stay ordered by run and by position in the run. */
+    ListSortSample_t* Src = Samples;
+    ListSortSample_t* Dst = Temp;
+
+    for(unsigned int Width = 1; Width < Count; Width *= 2)
+    {
+        for(unsigned int Lo = 0; Lo < Count; Lo += 2 * Width)
+        {
+            unsigned int Mid = (Count - Lo > Width ? Lo + Width : Count);
+            unsigned int Hi = (Count - Mid > Width ? Mid + Width : Count);
+            unsigned int A = Lo;
+            unsigned int B = Mid;
+
+            for(unsigned int i = Lo; i < Hi; i++)
+            {
+                Dst[i] = (((A < Mid) && ((B >= Hi) || (Compare(Src[B].Node->Data, Src[A].Node->Data) >= 0))) ?
+                          Src[A++] : Src[B++]);
+            }
+        }
+
+        ListSortSample_t* Swap = Src;
+        Src = Dst;
+        Dst = Swap;
+    }
+
+    if(Src != Samples)
+    {
+        memcpy(Samples, Src, Count * sizeof(ListSortSample_t));
+    }
+}
+
+static ListBool_t Static_IsBeforeSplitter(ListSortJob_t* Job, ListNode_t* Node, unsigned int Run,
+                                          ListSortSample_t* Splitter)
+{
+    /* Data equal to the splitter's is before it when it is in an earlier run, or earlier in the same
+       run. Runs are sorted stably, so the nodes of the splitter's run with equal data that come before
+       it are the ones met before it. */
+    int Order = Job->Compare(Node->Data, Splitter->Node->Data);
+
+    if(Order != 0)
+    {
+        return (Order < 0 ? LL_TRUE : LL_FALSE);
+    }
+    return (((Run < Splitter->Run) || ((Run == Splitter->Run) && (Node != Splitter->Node))) ? LL_TRUE : LL_FALSE);
+}
+
+static void Static_RunSortTask(ListSortTask_t* Task)
+{
+    ListSortJob_t* Job = Task->Job;
+    unsigned int NumTasks = Job->NumTasks;
+
+    if(Job->Phase == LL_SORT_RUNS)
+    {
+        Task->Head = Static_SortChain(Task->Head, Job->Compare);
+    }
+    else if(Job->Phase == LL_SORT_CUT)
+    {
+        /* Piece j holds the nodes that don't come before splitter j - 1 but come before splitter j */
+        ListNode_t* Node = Task->Head;
+
+        for(unsigned int j = 0; j < NumTasks; j++)
+        {
+            ListNode_t* Prev = NULL;
+            Job->Pieces[j * NumTasks + Task->Index] = Node;
+
+            while(Node &&
+                  ((j == NumTasks - 1) || Static_IsBeforeSplitter(Job, Node, Task->Index, &Job->Splitters[j])))
+            {
+                Prev = Node;
+                Node = Node->Next;
+            }
+
+            if(Prev)
+            {
+                Prev->Next = NULL;
+            }
+            else
+            {
+                Job->Pieces[j * NumTasks + Task->Index] = NULL;
+            }
+        }
+    }
+    else
+    {
+        /* The first and the last node of the merged piece are linked to the other pieces when all of
+           them are merged */
+        Task->Head = Static_MergeChains(Job->List, &Job->Pieces[Task->Index * NumTasks], NumTasks, Job->Compare,
+                                        &Task->Tail, &Task->Contiguous);
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI Static_SortThread(LPVOID Task)
+{
+    Static_RunSortTask((ListSortTask_t*)Task);
+    return 0;
+}
+
+static ListStatus_t Static_StartSortThread(ListSortTask_t* Task)
+{
+    Task->Thread = CreateThread(NULL, 0, Static_SortThread, Task, 0, NULL);
+    return (IS_NULL(Task->Thread) ? LL_NOT_OK : LL_OK);
+}
+
+static void Static_JoinSortThread(ListSortTask_t* Task)
+{
+    WaitForSingleObject(Task->Thread, INFINITE);
+    CloseHandle(Task->Thread);
+}
+
+static unsigned int Static_GetNumProcessors(void)
+{
+    SYSTEM_INFO Info;
+    GetSystemInfo(&Info);
+    return (unsigned int)Info.dwNumberOfProcessors;
+}
+#else
+static void* Static_SortThread(void* Task)
+{
+    Static_RunSortTask((ListSortTask_t*)Task);
+    return NULL;
+}
+
+static ListStatus_t Static_StartSortThread(ListSortTask_t* Task)
+{
+    return (pthread_create(&Task->Thread, NULL, Static_SortThread, Task) == 0 ? LL_OK : LL_NOT_OK);
+}
+
+static void Static_JoinSortThread(ListSortTask_t* Task)
+{
+    pthread_join(Task->Thread, NULL);
+}
+
+static unsigned int Static_GetNumProcessors(void)
+{
+    long NumProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+    return (NumProcessors > 0 ? (unsigned int)NumProcessors : 1);
+}
+#endif
+
+static void Static_RunSortPhase(ListSortJob_t* Job, ListSortPhase_t Phase)
+{
+    /* The calling thread runs the first task. A task whose thread can't be started runs right away in
+       the calling thread, the result is the same. */
+    ListBool_t Started[LL_MERGE_MAX_CHAINS];
+
+    Job->Phase = Phase;
+    for(unsigned int i = 1; i < Job->NumTasks; i++)
+    {
+        Started[i] = (Static_StartSortThread(&Job->Tasks[i]) == LL_OK) ? LL_TRUE : LL_FALSE;
+        if(!Started[i])
+        {
+            Static_RunSortTask(&Job->Tasks[i]);
+        }
+    }
+
+    Static_RunSortTask(&Job->Tasks[0]);
+
+    for(unsigned int i = 1; i < Job->NumTasks; i++)
+    {
+        if(Started[i])
+        {
+            Static_JoinSortThread(&Job->Tasks[i]);
+        }
+    }
+}
+
+static void Static_ParallelSort(ListSortJob_t* Job)
+{
+    List_t* List = Job->List;
+    unsigned int NumTasks = Job->NumTasks;
+    unsigned int SampleGap = (List->Count > Job->NumSamples ? List->Count / Job->NumSamples : 1);
+    unsigned int NumSamples = 0;
+
+    /* Cut the list into segments, turning XOR links into plain Next links and sampling data on the way */
+    ListNode_t* Node = List->Head;
+    ListNode_t* Prev = NULL;
+    unsigned int Gap = 0;
+
+    for(unsigned int i = 0; i < NumTasks; i++)
+    {
+        ListSortTask_t* Task = &Job->Tasks[i];
+        Task->Job = Job;
+        Task->Index = i;
+        Task->Count = List->Count / NumTasks + (i < List->Count % NumTasks);
+        Task->Head = Node;
+
+        for(unsigned int n = 0; n < Task->Count; n++)
+        {
+            ListNode_t* Next = Static_GetNextNode(List, Node, Prev);
+            Node->Next = (n + 1 < Task->Count ? Next : NULL);
+
+            if((++Gap == SampleGap) && (NumSamples < Job->NumSamples))
+            {
+                Job->Samples[NumSamples].Node = Node;
+                Job->Samples[NumSamples].Run = i;
+                NumSamples++;
+                Gap = 0;
+            }
+            Prev = Node;
+            Node = Next;
+        }
+    }
+
+    Static_RunSortPhase(Job, LL_SORT_RUNS);
+
+    Static_SortSamples(Job->Samples, Job->Samples + NumSamples, NumSamples, Job->Compare);
+    for(unsigned int j = 1; j < NumTasks; j++)
+    {
+        Job->Splitters[j - 1] = Job->Samples[j * NumSamples / NumTasks];
+    }
+
+    Static_RunSortPhase(Job, LL_SORT_CUT);
+    Static_RunSortPhase(Job, LL_SORT_MERGE);
+
+    /* Link the merged pieces to each other, empty pieces are skipped */
+    ListBool_t Contiguous = LL_TRUE;
+    ListNode_t* Head = NULL;
+    Prev = NULL;
+
+    for(unsigned int i = 0; i < NumTasks; i++)
+    {
+        ListSortTask_t* Task = &Job->Tasks[i];
+
+        if(IS_NULL(Task->Head))
+        {
+            continue;
+        }
+
+        if(IS_NULL(Prev))
+        {
+            Head = Task->Head;
+        }
+        else if(List->Linkage == LL_XOR)
+        {
+            Prev->Next = XOR_LINK(Prev->Next, Task->Head);
+            Task->Head->Next = XOR_LINK(Task->Head->Next, Prev);
+        }
+        else
+        {
+            Prev->Next = Task->Head;
+            if(List->Linkage == LL_DOUBLE)
+            {
+                Task->Head->Prev = Prev;
+            }
+        }
+
+        if(!Task->Contiguous || (Prev && ((char*)Prev + List->Pool.NodeSize != (char*)Task->Head)))
+        {
+            Contiguous = LL_FALSE;
+        }
+        Prev = Task->Tail;
+    }
+
+    List->Head = Head;
+    List->Tail = Prev;
+    List->Contiguous = Contiguous;
+
+    if(List->SkipIndex)
+    {
+        Static_SkipRetarget(List);
+    }
+}
+#endif
+
+ListStatus_t LL_ParallelSort(List_t* List, ListCompareFn_t Compare, unsigned int NumThreads)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Compare) || IS_SORTED(List));
+
+#ifdef LL_HAVE_THREADS
+    if(NumThreads == 0)
+    {
+        NumThreads = Static_GetNumProcessors();
+    }
+    if(NumThreads > List->Count / LL_SORT_MIN_NODES_PER_THREAD)
+    {
+        NumThreads = List->Count / LL_SORT_MIN_NODES_PER_THREAD;
+    }
+    if(NumThreads > LL_MERGE_MAX_CHAINS)
+    {
+        NumThreads = LL_MERGE_MAX_CHAINS;
+    }
+
+    if(NumThreads > 1)
+    {
+        ListSortJob_t Job;
+        size_t NumSamples = (size_t)NumThreads * LL_SORT_SAMPLES_PER_THREAD;
+        NumSamples = (NumSamples > List->Count ? List->Count : NumSamples);
+
+        Job.List = List;
+        Job.Compare = Compare;
+        Job.NumTasks = NumThreads;
+        Job.NumSamples = (unsigned int)NumSamples;
+        Job.Samples = List->Allocator.Alloc((2 * NumSamples + NumThreads - 1) * sizeof(ListSortSample_t) +
+                                            (size_t)NumThreads * NumThreads * sizeof(ListNode_t*),
+                                            List->Allocator.Ctx);
+
+        /* Without this memory the list is sorted by the calling thread */
+        if(Job.Samples)
+        {
+            Job.Splitters = Job.Samples + 2 * NumSamples;
+            Job.Pieces = (ListNode_t**)(Job.Splitters + NumThreads - 1);
+            Static_ParallelSort(&Job);
+            List->Allocator.Free(Job.Samples, List->Allocator.Ctx);
+            return LL_OK;
+        }
+    }
+#else
+    (void)NumThreads;
+#endif
+
+    return LL_Sort(List, Compare);
+}
+
+static ListNode_t* Static_MergeLists(List_t* Dest, List_t** Lists, unsigned int NumLists, ListCompareFn_t Compare,
+                                     ListNode_t** Tail, ListBool_t* Contiguous)
+{
+    /* Merge the sorted chains of the lists, linked through their Next fields, into one chain linked like
+       the nodes of Dest. LL_MERGE_MAX_CHAINS chains are merged at a time: the chain merged from a group
+       of lists is kept in the head of the first list of the group for the next round, so merging any
+       number of lists doesn't allocate memory. */
+    ListNode_t* Heads[LL_MERGE_MAX_CHAINS];
+    unsigned int NumChains = NumLists;
+    unsigned int Stride = 1;
+    unsigned int n = 0;
+
+    while(NumChains > LL_MERGE_MAX_CHAINS)
+    {
+        for(unsigned int First = 0; First < NumLists; First += Stride * LL_MERGE_MAX_CHAINS)
+        {
+            n = 0;
+            for(unsigned int i = First; (i < NumLists) && (n < LL_MERGE_MAX_CHAINS); i += Stride)
+            {
+                Heads[n++] = Lists[i]->Head;
+            }
+            Lists[First]->Head = Static_MergeChains(NULL, Heads, n, Compare, Tail, Contiguous);
+        }
+
+        NumChains = (NumChains + LL_MERGE_MAX_CHAINS - 1) / LL_MERGE_MAX_CHAINS;
+        Stride *= LL_MERGE_MAX_CHAINS;
+    }
+
+    n = 0;
+    for(unsigned int i = 0; i < NumLists; i += Stride)
+    {
+        Heads[n++] = Lists[i]->Head;
+    }
+
+    return Static_MergeChains(Dest, Heads, n, Compare, Tail, Contiguous);
+}
+
+ListStatus_t LL_MergeSorted(List_t** Lists, unsigned int NumLists, ListCompareFn_t Compare, List_t* Out)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Lists) || IS_NULL(Compare) || IS_NULL(Out) ||
+                        (IS_SORTED(Out) && (Out->Compare != Compare)));
+
+    /* Everything that can fail is done before the lists are changed. Each list is marked as forwarding
+       its nodes to Out once it's checked, which finds the lists given twice. */
+    unsigned int NumNodes = 0;
+    unsigned int i;
+
+    for(i = 0; i < NumLists; i++)
+    {
+        List_t* List = Lists[i];
+
+        if(IS_NULL(List) || (List == Out) || List->Forward || !Static_CanShareNodes(Out, List))
+        {
+            break;
+        }
+        List->Forward = Out;
+        NumNodes += List->Count;
+    }
+
+    ListSkipTower_t** Towers = NULL;
+    if((i < NumLists) || (Static_ReserveChain(Out, NumNodes, &Towers) != LL_OK))
+    {
+        while(i-- > 0)
+        {
+            Lists[i]->Forward = NULL;
+        }
+        return LL_NOT_OK;
+    }
+
+    /* Merge the nodes of the lists, then retire the lists like LL_Concat does */
+    ListNode_t* First = NULL;
+    ListNode_t* Last = NULL;
+    ListBool_t Contiguous = LL_TRUE;
+
+    if(NumNodes > 0)
+    {
+        for(i = 0; i < NumLists; i++)
+        {
+            if(Lists[i]->Linkage == LL_XOR)
+            {
+                Static_UnXorLinks(Lists[i]);
+            }
+        }
+        First = Static_MergeLists(Out, Lists, NumLists, Compare, &Last, &Contiguous);
+    }
+
+    for(i = 0; i < NumLists; i++)
+    {
+        if(IS_EMPTY(Lists[i]))
+        {
+            /* Its head may hold a chain merged in a previous round */
+            Lists[i]->Head = NULL;
+            Lists[i]->Forward = NULL;
+            LL_DeleteList(Lists[i]);
+        }
+        else
+        {
+            Static_AbsorbList(Out, Lists[i]);
+        }
+    }
+
+    /* The merged nodes go after the tail of Out. If Out had nodes, its own sorted run is merged with
+       them, its nodes first on equivalent data. */
+    ListNode_t* Prev = Out->Tail;
+
+    if(First)
+    {
+        Static_LinkChain(Out, First, Last, Prev, NULL);
+        Out->Count += NumNodes;
+    }
+    Static_IndexChain(Out, First, Prev, NumNodes, Towers);
+
+    if(IS_NULL(First))
+    {
+        return LL_OK;
+    }
+
+    if(IS_NULL(Prev))
+    {
+        Out->Contiguous = Contiguous;
+    }
+    else
+    {
+        if(Out->Linkage == LL_XOR)
+        {
+            Static_UnXorLinks(Out);
+        }
+        Prev->Next = NULL;
+        Static_RestoreLinks(Out, Static_MergeRuns(Out->Head, First, Compare));
+    }
+
+    return LL_OK;
+}
+
+ListNode_t* LL_GetNodeAt(List_t* List, unsigned int Index)
+{
+    RETURN_NULL_IF(IS_INVALID_OR_EMPTY(List) || (Index >= List->Count));
+
+    ListNode_t* Prev;
+    return Static_GetNodeAt(List, Index, &Prev);
+}
+
+ListStatus_t LL_GetNodeIndex(ListNode_t* Node, unsigned int* Index)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node) || IS_NULL(Index));
+
+    List_t* List = Static_GetOwner(Node);
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
+
+    if(List->SkipIndex)
+    {
+        *Index = Static_SkipClimb(List->SkipIndex, Node, NULL, NULL) - 1;
+        return LL_OK;
+    }
+
+    ListNode_t* Iter = List->Head;
+    ListNode_t* IterPrev = NULL;
+    unsigned int i = 0;
+
+    while(Iter && (Iter != Node))
+    {
+        ListNode_t* Next = Static_GetNextNode(List, Iter, IterPrev);
+        IterPrev = Iter;
+        Iter = Next;
+        i++;
+    }
+    RETURN_LL_NOT_OK_IF(IS_NULL(Iter));
+
+    *Index = i;
+    return LL_OK;
+}
+
+ListStatus_t LL_InsertAt(List_t* List, unsigned int Index, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || (Index > List->Count) || IS_SORTED(List));
+
+    /* The new node goes before the node at Index, or after the tail */
+    ListNode_t* Prev = List->Tail;
+    ListNode_t* Next = NULL;
+
+    if(Index < List->Count)
+    {
+        Next = Static_GetNodeAt(List, Index, &Prev);
+    }
+
+    ListNode_t* Node = Static_NewNode(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+
+    Static_SetNodeData(List, Node, Data);
+    Static_LinkNode(List, Node, Prev, Next);
+
+    return LL_OK;
+}
+
+ListStatus_t LL_RemoveAt(List_t* List, unsigned int Index)
+{
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List) || (Index >= List->Count));
+
+    ListNode_t* Prev;
+    ListNode_t* Node = Static_GetNodeAt(List, Index, &Prev);
+
+    Static_RemoveNode(List, Node, Prev, Static_GetNextNode(List, Node, Prev));
+
+    return LL_OK;
+}
+
+ListStatus_t LL_EnableBloomFilter(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || (List->ElemSize != 0));
+
+    if(IS_NULL(List->BloomFilter))
+    {
+        size_t Size = LL_BLOOM_FIRST_SIZE;
+        while(List->Count * LL_BLOOM_COUNTERS_PER_NODE > Size)
+        {
+            Size *= 2;
+        }
+
+        return Static_BloomBuild(List, Size);
+    }
+
+    return LL_OK;
+}
+
+ListStatus_t LL_SetLookupPolicy(List_t* List, ListLookupPolicy_t Policy)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || (Policy > LL_LOOKUP_TRANSPOSE));
+
+    /* Reordering would break the order of a sorted list, and would walk the list to find the prev
+       node of every node found by the hash index of a singly or XOR linked list */
+    RETURN_LL_NOT_OK_IF((IS_SORTED(List) || (List->HashIndex && (List->Linkage != LL_DOUBLE))) &&
+                        (Policy != LL_LOOKUP_PLAIN));
+
+    List->LookupPolicy = Policy;
+    return LL_OK;
+}
+
+ListStatus_t LL_GetLookupStats(List_t* List, ListLookupStats_t* Stats)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Stats));
+    *Stats = List->LookupStats;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_ResetLookupStats(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List));
+    List->LookupStats.NumLookups = List->LookupStats.NumFound = List->LookupStats.NumProbes = 0;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_EnableHashIndex(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || (List->ElemSize != 0));
+    RETURN_LL_NOT_OK_IF((List->LookupPolicy != LL_LOOKUP_PLAIN) && (List->Linkage != LL_DOUBLE));
+
+    if(IS_NULL(List->HashIndex))
+    {
+        List->HashIndex = Static_HashNew(List, LL_HASH_FIRST_CAPACITY);
+        RETURN_LL_NOT_OK_IF(IS_NULL(List->HashIndex));
+
+        /* Index the nodes that are already in the list */
+        if(Static_HashReserve(List, &List->HashIndex, List->Count) != LL_OK)
+        {
+            Static_FreeHashIndex(List);
+            return LL_NOT_OK;
+        }
+
+        ListNode_t* Iter = List->Head;
+        ListNode_t* IterPrev = NULL;
+
+        while(Iter)
+        {
+            Static_HashAdd(List, Iter);
+
+            ListNode_t* Next = Static_GetNextNode(List, Iter, IterPrev);
+            IterPrev = Iter;
+            Iter = Next;
+        }
+    }
+
+    return LL_OK;
+}
+
+ListStatus_t LL_EnablePositionIndex(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || (List->Linkage != LL_DOUBLE));
+
+    if(IS_NULL(List->SkipIndex))
+    {
+        ListSkipIndex_t* Index = List->Allocator.Alloc(sizeof(ListSkipIndex_t), List->Allocator.Ctx);
+        RETURN_LL_NOT_OK_IF(IS_NULL(Index));
+
+        Index->Sentinel = Static_SkipNewTower(List, LL_SKIP_MAX_LEVEL);
+        Index->Spare = NULL;
+        Index->Towers = Static_HashNew(List, LL_HASH_FIRST_CAPACITY);
+        Index->Seed = 0x9E3779B9u;
+        List->SkipIndex = Index;
+
+        /* Index the nodes that are already in the list */
+        if(IS_NULL(Index->Sentinel) || IS_NULL(Index->Towers) || (Static_SkipBuild(List) != LL_OK))
+        {
+            Static_FreeSkipIndex(List);
+            return LL_NOT_OK;
+        }
+
+        Index->NextHeight = Static_SkipRandomHeight(Index);
+    }
+
+    return LL_OK;
+}
+
+ListStatus_t LL_Clear(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List));
+
+    /* The nodes are not visited, unless the list shares its chunks with other lists */
+    if(List->PoolGroup)
+    {
+        Static_ReleaseNodes(List);
+    }
+    else
+    {
+        Static_ResetPool(List);
+    }
+
+    if(List->HashIndex)
+    {
+        Static_HashClear(List->HashIndex);
+    }
+    if(List->SkipIndex)
+    {
+        Static_SkipClear(List);
+    }
+    if(List->BloomFilter)
+    {
+        memset(List->BloomFilter->Counters, 0, List->BloomFilter->Size);
+    }
+
+    /* No node refers to the lists merged into this one anymore */
+    Static_FreeAbsorbed(List);
+    List->Head = List->Tail = NULL;
+    List->Count = 0;
+    List->NumRefs = List->NumForwarded = 0;
+    List->Contiguous = LL_TRUE;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_DeleteList(List_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List));
+
+    /* All nodes live in the pool's chunks, so releasing the chunks frees them without unlinking each one
+       (unless the chunks are shared with other lists) */
+    Static_FreePool(List);
+    Static_FreeHashIndex(List);
+    Static_FreeSkipIndex(List);
+    Static_FreeBloomFilter(List);
+    Static_FreeAbsorbed(List);
+    List->Allocator.Free(List, List->Allocator.Ctx);
+
+    return LL_OK;
+}
+
+
+ListStatus_t LL_CursorToHead(List_t* List, ListCursor_t* Cursor)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Cursor));
+    Cursor->Node = NULL;
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
+
+    Cursor->List = List;
+    Cursor->Prev = NULL;
+    Cursor->Node = List->Head;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_CursorToTail(List_t* List, ListCursor_t* Cursor)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Cursor));
+    Cursor->Node = NULL;
+    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
+
+    ListNode_t* Prev;
+    RETURN_LL_NOT_OK_IF(Static_GetPrevNode(List, List->Tail, &Prev) != LL_OK);
+
+    Cursor->List = List;
+    Cursor->Prev = Prev;
+    Cursor->Node = List->Tail;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_CursorNext(ListCursor_t* Cursor)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Cursor) || IS_NULL(Cursor->Node) || IS_INVALID_OR_EMPTY(Cursor->List));
+
+    ListNode_t* Next = Static_GetNextNode(Cursor->List, Cursor->Node, Cursor->Prev);
+    RETURN_LL_NOT_OK_IF(IS_NULL(Next));
+
+    Cursor->Prev = Cursor->Node;
+    Cursor->Node = Next;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_CursorPrev(ListCursor_t* Cursor)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Cursor) || IS_NULL(Cursor->Node) || IS_INVALID_OR_EMPTY(Cursor->List));
+    RETURN_LL_NOT_OK_IF(IS_NULL(Cursor->Prev) || (Cursor->List->Linkage == LL_SINGLE));
+
+    /* The new prev node is the one before the current prev node */
+    ListNode_t* Node = Cursor->Node;
+    Cursor->Node = Cursor->Prev;
+    Cursor->Prev = (Cursor->List->Linkage == LL_XOR ? XOR_LINK(Cursor->Node->Next, Node) : Cursor->Node->Prev);
+
+    return LL_OK;
+}
+
+ListNode_t* LL_CursorGetNode(ListCursor_t* Cursor)
+{
+    return (Cursor ? Cursor->Node : NULL);
+}
+
+ListStatus_t LL_CursorRemove(ListCursor_t* Cursor)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Cursor) || IS_NULL(Cursor->Node) || IS_INVALID_OR_EMPTY(Cursor->List));
+
+    /* The cursor knows the prev node, so no list walk is needed whatever the linkage */
+    ListNode_t* Next = Static_GetNextNode(Cursor->List, Cursor->Node, Cursor->Prev);
+    Static_RemoveNode(Cursor->List, Cursor->Node, Cursor->Prev, Next);
+    Cursor->Node = Next;
+
+    return LL_OK;
+}
+
+static ListNode_t* Static_StepNode(List_t* List, ListNode_t* Node, ListNode_t* From, ListBool_t Reverse)
+{
+    /* The link of an XOR linked list node gives the node on the other side of From, in both directions */
+    return ((Reverse && (List->Linkage == LL_DOUBLE)) ? Node->Prev : Static_GetNextNode(List, Node, From));
+}
+
+static ListStatus_t Static_ForEach(List_t* List, ListVisitFn_t Visit, void* Ctx, ListBool_t Reverse)
+{
+    if(List->Contiguous)
+    {
+        /* The nodes are consecutive in memory, so the lookahead node is found without loading the
+           nodes before it: only the data has to be prefetched */
+        char* First = (char*)(Reverse ? List->Tail : List->Head);
+        ptrdiff_t Stride = (Reverse ? -(ptrdiff_t)List->Pool.NodeSize : (ptrdiff_t)List->Pool.NodeSize);
+
+        for(unsigned int i = 0; i < List->Count; i++)
+        {
+            if(i + LL_PREFETCH_DISTANCE < List->Count)
+            {
+                LL_PREFETCH(((ListNode_t*)(First + (ptrdiff_t)(i + LL_PREFETCH_DISTANCE) * Stride))->Data);
+            }
+            if(!Visit(((ListNode_t*)(First + (ptrdiff_t)i * Stride))->Data, Ctx))
+            {
+                break;
+            }
+        }
+
+        return LL_OK;
+    }
+
+    ListNode_t* Node = (Reverse ? List->Tail : List->Head);
+    ListNode_t* From = NULL;
+    ListNode_t* Ahead = Node;
+    ListNode_t* AheadFrom = NULL;
+
+    /* Put the lookahead node LL_PREFETCH_DISTANCE positions ahead */
+    for(unsigned int i = 0; Ahead && (i < LL_PREFETCH_DISTANCE); i++)
+    {
+        LL_PREFETCH(Ahead->Data);
+        ListNode_t* Next = Static_StepNode(List, Ahead, AheadFrom, Reverse);
+        AheadFrom = Ahead;
+        Ahead = Next;
+    }
+
+    while(Node)
+    {
+        if(Ahead)
+        {
+            /* The lookahead node was prefetched on the previous step, its links and data should be
+               in the cache by now, or at least on the way */
+            LL_PREFETCH(Ahead->Data);
+            ListNode_t* Next = Static_StepNode(List, Ahead, AheadFrom, Reverse);
+            AheadFrom = Ahead;
+            Ahead = Next;
+            LL_PREFETCH(Ahead);
+        }
+
+        if(!Visit(Node->Data, Ctx))
+        {
+            break;
+        }
+
+        ListNode_t* Next = Static_StepNode(List, Node, From, Reverse);
+        From = Node;
+        Node = Next;
+    }
+
+    return LL_OK;
+}
+
+ListStatus_t LL_ForEach(List_t* List, ListVisitFn_t Visit, void* Ctx)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Visit));
+    return Static_ForEach(List, Visit, Ctx, LL_FALSE);
+}
+
+ListStatus_t LL_ForEachReverse(List_t* List, ListVisitFn_t Visit, void* Ctx)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Visit) || (List->Linkage == LL_SINGLE));
+    return Static_ForEach(List, Visit, Ctx, LL_TRUE);
+}
+
+ListStatus_t LL_GetArrayView(List_t* List, ListArrayView_t* View)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(View) || !List->Contiguous);
+
+    View->Data = (List->Head ? (char*)&List->Head->Data : NULL);
+    View->Stride = List->Pool.NodeSize;
+    View->Count = List->Count;
+
+    return LL_OK;
+}
+
+ListStatus_t LL_ToArray(List_t* List, void** Data, unsigned int MaxData, unsigned int* NumData)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_NULL(NumData));
+
+    unsigned int Count = (List->Count < MaxData ? List->Count : MaxData);
+    ListArrayView_t View;
+
+    if(LL_GetArrayView(List, &View) == LL_OK)
+    {
+        /* The nodes are consecutive, no links to follow */
+        for(unsigned int i = 0; i < Count; i++)
+        {
+            Data[i] = LL_VIEW_DATA(&View, i);
+        }
+    }
+    else
+    {
+        ListNode_t* Node = List->Head;
+        ListNode_t* Prev = NULL;
+        ListNode_t* Ahead = Node;
+        ListNode_t* AheadPrev = NULL;
+
+        /* Put the lookahead node LL_PREFETCH_DISTANCE positions ahead */
+        for(unsigned int i = 0; Ahead && (i < LL_PREFETCH_DISTANCE); i++)
+        {
+            ListNode_t* Next = Static_GetNextNode(List, Ahead, AheadPrev);
+            AheadPrev = Ahead;
+            Ahead = Next;
+        }
+
+        for(unsigned int i = 0; i < Count; i++)
+        {
+            if(Ahead)
+            {
+                ListNode_t* Next = Static_GetNextNode(List, Ahead, AheadPrev);
+                AheadPrev = Ahead;
+                Ahead = Next;
+                LL_PREFETCH(Ahead);
+            }
+
+            Data[i] = Node->Data;
+
+            ListNode_t* Next = Static_GetNextNode(List, Node, Prev);
+            Prev = Node;
+            Node = Next;
+        }
+    }
+
+    *NumData = Count;
+    return LL_OK;
+}
+
+List_t* LL_FromArray(ListLinkage_t Linkage, void* const* Data, unsigned int NumData)
+{
+    RETURN_NULL_IF(IS_NULL(Data));
+
+    for(unsigned int i = 0; i < NumData; i++)
+    {
+        RETURN_NULL_IF(IS_NULL(Data[i]));
+    }
+
+    List_t* List = LL_NewList(Linkage);
+    RETURN_NULL_IF(IS_NULL(List));
+
+    /* The nodes are linked in one pass, in a chunk allocated for all of them */
+    if(NumData && (Static_AddArray(List, Data, NumData, NULL, NULL) != LL_OK))
+    {
+        LL_DeleteList(List);
+        return NULL;
+    }
+
+    return List;
+}
+
+
+/* ------------------------------------------------------------------------------------------------ */
+/* Intrusive lists */
+
+ListStatus_t LL_IntrusiveInit(IntrusiveList_t* List)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List));
+
+    List->Head = NULL;
+    List->Tail = NULL;
+    List->Count = 0;
+
+    return LL_OK;
+}
+
+
+ListLink_t* LL_IntrusiveGetHead(IntrusiveList_t* List)
+{
+    return (List ? List->Head : NULL);
+}
+
+
+ListLink_t* LL_IntrusiveGetTail(IntrusiveList_t* List)
+{
+    return (List ? List->Tail : NULL);
+}
+
+
+ListLink_t* LL_IntrusiveGetNext(ListLink_t* Link)
+{
+    return (Link ? Link->Next : NULL);
+}
+
+
+ListLink_t* LL_IntrusiveGetPrev(ListLink_t* Link)
+{
+    return (Link ? Link->Prev : NULL);
+}
+
+
+ListStatus_t LL_IntrusiveAddToFront(IntrusiveList_t* List, ListLink_t* Link)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Link));
+
+    Link->Prev = NULL;
+    Link->Next = List->Head;
+
+    if(List->Head)
+    {
+        List->Head->Prev = Link;
+    }
+    else
+    {
+        List->Tail = Link;
+    }
+
+    List->Head = Link;
+    List->Count++;
+
+    return LL_OK;
+}
+
+
+ListStatus_t LL_IntrusiveAddToBack(IntrusiveList_t* List, ListLink_t* Link)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Link));
+
+    Link->Next = NULL;
+    Link->Prev = List->Tail;
+
+    if(List->Tail)
+    {
+        List->Tail->Next = Link;
+    }
+    else
+    {
+        List->Head = Link;
+    }
+
+    List->Tail = Link;
+    List->Count++;
+
+    return LL_OK;
+}
+
+
+ListStatus_t LL_IntrusiveInsertAfter(IntrusiveList_t* List, ListLink_t* Existing, ListLink_t* Link)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Existing) || IS_NULL(Link) || IS_INVALID_OR_EMPTY(List));
+
+    Link->Prev = Existing;
+    Link->Next = Existing->Next;
+    Existing->Next = Link;
+
+    if(Link->Next)
+    {
+        Link->Next->Prev = Link;
+    }
+    else
+    {
+        List->Tail = Link;
+    }
+
+    List->Count++;
+
+    return LL_OK;
+}
+
+
+ListStatus_t LL_IntrusiveRemove(IntrusiveList_t* List, ListLink_t* Link)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(Link) || IS_INVALID_OR_EMPTY(List));
+
+    /* Only the head has no prev link and only the tail has no next link */
+    RETURN_LL_NOT_OK_IF((IS_NULL(Link->Prev) && (Link != List->Head)) ||
+                        (IS_NULL(Link->Next) && (Link != List->Tail)));
+
+    if(Link->Prev)
+    {
+        Link->Prev->Next = Link->Next;
+    }
+    else
+    {
+        List->Head = Link->Next;
+    }
+
+    if(Link->Next)
+    {
+        Link->Next->Prev = Link->Prev;
+    }
+    else
+    {
+        List->Tail = Link->Prev;
+    }
+
+    Link->Prev = Link->Next = NULL;
+    List->Count--;
+
+    return LL_OK;
+}
+
+
+ListStatus_t LL_IntrusiveGetCount(IntrusiveList_t* List, unsigned int* Count)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Count));
+    *Count = List->Count;
+
+    return LL_OK;
+}
+
+
+/* ------------------------------------------------------------------------------------------------ */
+/* Index lists */
+
+/* Number of nodes in the first node array of an index list. The array doubles in size when it's full. */
+#ifndef LL_INDEX_FIRST_CAPACITY
+#define LL_INDEX_FIRST_CAPACITY     16
+#endif
+
+static ListHandle_t Static_IndexNewNode(IndexList_t* List)
+{
+    ListHandle_t Handle = List->FreeNodes;
+
+    if(Handle != LL_NULL_HANDLE)
+    {
+        /* Reuse a removed node */
+        List->FreeNodes = List->Nodes[Handle].Next;
+        return Handle;
+    }
+
+    if(List->Used == List->Capacity)
+    {
+        /* Grow the array, the last handle value is reserved for LL_NULL_HANDLE */
+        uint32_t Capacity = (List->Capacity ? List->Capacity : LL_INDEX_FIRST_CAPACITY / 2);
+        Capacity = (Capacity > (LL_NULL_HANDLE / 2) ? LL_NULL_HANDLE : Capacity * 2);
+        if((Capacity == List->Capacity) || (LL_IndexReserve(List, Capacity) != LL_OK))
+        {
+            return LL_NULL_HANDLE;
+        }
+    }
 
+    return List->Used++;
+}
 
-static ListNode_t* Static_GetNodeByData(List_t* List, void* Data)
+static void Static_IndexLinkNode(IndexList_t* List, ListHandle_t Handle, ListHandle_t Prev, ListHandle_t Next,
+                                 void* Data)
 {
-    ListNode_t* Iter = List->Head;
+    IndexNode_t* Node = &List->Nodes[Handle];
+    Node->Prev = Prev;
+    Node->Next = Next;
+    Node->Data = Data;
 
-    while(Iter && (Iter->Data != Data))
+    if(Prev != LL_NULL_HANDLE)
+    {
+        List->Nodes[Prev].Next = Handle;
+    }
+    else
     {
-        Iter = Iter->Next;
+        List->Head = Handle;
     }
 
-    return Iter;
+    if(Next != LL_NULL_HANDLE)
+    {
+        List->Nodes[Next].Prev = Handle;
+    }
+    else
+    {
+        List->Tail = Handle;
+    }
+
+    List->Count++;
 }
 
-static ListNode_t* Static_NewNode(void)
+IndexList_t* LL_NewIndexList(void)
 {
-    ListNode_t* Node = malloc(sizeof(ListNode_t));
+    return LL_NewIndexListWithAllocator(Static_DefaultAlloc, Static_DefaultFree, NULL);
+}
 
-    if(Node)
+IndexList_t* LL_NewIndexListWithAllocator(ListAllocFn_t Alloc, ListFreeFn_t Free, void* Ctx)
+{
+    RETURN_NULL_IF(IS_NULL(Alloc) || IS_NULL(Free));
+
+    IndexList_t* List = Alloc(sizeof(IndexList_t), Ctx);
+
+    if(List)
     {
-        Node->Data = Node->Next = Node->Prev = NULL;
+        List->Nodes = NULL;
+        List->Capacity = 0;
+        List->Used = 0;
+        List->FreeNodes = LL_NULL_HANDLE;
+        List->Head = LL_NULL_HANDLE;
+        List->Tail = LL_NULL_HANDLE;
+        List->Count = 0;
+        List->Allocator.Alloc = Alloc;
+        List->Allocator.Free = Free;
+        List->Allocator.Ctx = Ctx;
     }
 
-    return Node;
+    return List;
 }
 
-static void Static_RemoveHead(List_t* List)
+ListStatus_t LL_IndexReserve(IndexList_t* List, uint32_t Capacity)
 {
-    /* Remove head */
-    ListNode_t* OldHead = List->Head;
-    List->Head = List->Head->Next;
-    List->Count--;
-    free(OldHead);
+    RETURN_LL_NOT_OK_IF(IS_NULL(List));
 
-    if(IS_NULL(List->Head))
-    {
-        /* Remove the tail link too if the list is now empty */
-        List->Tail = NULL;
-    }
-    else if(List->Linkage == LL_DOUBLE)
+    if(Capacity > List->Capacity)
     {
-        /* Remove backward link of new head */
-        List->Head->Prev = NULL;
+        IndexNode_t* Nodes = List->Allocator.Alloc(Capacity * sizeof(IndexNode_t), List->Allocator.Ctx);
+        RETURN_LL_NOT_OK_IF(IS_NULL(Nodes));
+
+        /* Links are indices, so the nodes can be moved as they are */
+        if(List->Nodes)
+        {
+            memcpy(Nodes, List->Nodes, List->Used * sizeof(IndexNode_t));
+            List->Allocator.Free(List->Nodes, List->Allocator.Ctx);
+        }
+
+        List->Nodes = Nodes;
+        List->Capacity = Capacity;
     }
+
+    return LL_OK;
 }
 
-static ListNode_t* Static_GetPrevNode(ListNode_t* Node)
+ListHandle_t LL_IndexGetHead(IndexList_t* List)
 {
-    ListNode_t* Iter = Node->Owner->Head;
+    return (List ? List->Head : LL_NULL_HANDLE);
+}
 
-    while(Iter && (Iter->Next != Node))
-    {
-        Iter = Iter->Next;
-    }
+ListHandle_t LL_IndexGetTail(IndexList_t* List)
+{
+    return (List ? List->Tail : LL_NULL_HANDLE);
+}
 
-    return Iter;
+ListHandle_t LL_IndexGetNext(IndexList_t* List, ListHandle_t Handle)
+{
+    return ((List && !IS_INVALID_HANDLE(List, Handle)) ? List->Nodes[Handle].Next : LL_NULL_HANDLE);
 }
 
-static void Static_RemoveTail(List_t* List)
+ListHandle_t LL_IndexGetPrev(IndexList_t* List, ListHandle_t Handle)
 {
-    /* Remove tail */
-    ListNode_t* OldTail = List->Tail;
-    List->Tail = (List->Linkage == LL_DOUBLE ? List->Tail->Prev : Static_GetPrevNode(List->Tail));
-    List->Count--;
-    free(OldTail);
-   
-    if(List->Tail)
+    return ((List && !IS_INVALID_HANDLE(List, Handle)) ? List->Nodes[Handle].Prev : LL_NULL_HANDLE);
+}
+
+void* LL_IndexGetData(IndexList_t* List, ListHandle_t Handle)
+{
+    return ((List && !IS_INVALID_HANDLE(List, Handle)) ? List->Nodes[Handle].Data : NULL);
+}
+
+ListHandle_t LL_IndexGetHandleByData(IndexList_t* List, void* Data)
+{
+    if(IS_NULL(List) || IS_NULL(Data))
     {
-        /* Remove forward link */
-        List->Tail->Next = NULL;
+        return LL_NULL_HANDLE;
     }
-    else
+
+    ListHandle_t Iter = List->Head;
+
+    while((Iter != LL_NULL_HANDLE) && (List->Nodes[Iter].Data != Data))
     {
-        /* Change the head too if the there was only one node in the list */
-        List->Head = NULL;
+        Iter = List->Nodes[Iter].Next;
     }
+
+    return Iter;
 }
 
-static ListNode_t* Static_GetPrevNodeByData(List_t* List, void* Data)
+ListStatus_t LL_IndexSetData(IndexList_t* List, ListHandle_t Handle, void* Data)
 {
-    ListNode_t* Iter = List->Head;
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_INVALID_HANDLE(List, Handle));
 
-    while(Iter && Iter->Next)
-    {
-        if(Iter->Next->Data == Data)
-        {
-            return Iter;
-        }
-        Iter = Iter->Next;
-    }
+    List->Nodes[Handle].Data = Data;
+    return LL_OK;
+}
 
-    return NULL;
+ListStatus_t LL_IndexAddToFront(IndexList_t* List, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data));
+
+    ListHandle_t Handle = Static_IndexNewNode(List);
+    RETURN_LL_NOT_OK_IF(Handle == LL_NULL_HANDLE);
+
+    Static_IndexLinkNode(List, Handle, LL_NULL_HANDLE, List->Head, Data);
+    return LL_OK;
+}
+
+ListStatus_t LL_IndexAddToBack(IndexList_t* List, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data));
+
+    ListHandle_t Handle = Static_IndexNewNode(List);
+    RETURN_LL_NOT_OK_IF(Handle == LL_NULL_HANDLE);
+
+    Static_IndexLinkNode(List, Handle, List->Tail, LL_NULL_HANDLE, Data);
+    return LL_OK;
 }
 
+ListStatus_t LL_IndexInsertAfter(IndexList_t* List, ListHandle_t Existing, void* Data)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_INVALID_HANDLE(List, Existing));
+
+    ListHandle_t Handle = Static_IndexNewNode(List);
+    RETURN_LL_NOT_OK_IF(Handle == LL_NULL_HANDLE);
+
+    /* The node array may have moved, so it's only accessed after allocating the new node */
+    Static_IndexLinkNode(List, Handle, Existing, List->Nodes[Existing].Next, Data);
+    return LL_OK;
+}
 
-static void Static_InsertNewNodeAfterNode(ListNode_t* New, ListNode_t* Existing)
+ListStatus_t LL_IndexRemove(IndexList_t* List, ListHandle_t Handle)
 {
-    /* Fwd links */
-    New->Next = Existing->Next;
-    Existing->Next = New;
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_INVALID_HANDLE(List, Handle));
+
+    IndexNode_t* Node = &List->Nodes[Handle];
 
-    /* Bwd links */
-    if(Existing->Owner->Linkage == LL_DOUBLE)
+    /* Bypass node */
+    if(Node->Prev != LL_NULL_HANDLE)
     {
-        New->Prev = Existing;
-        if(New->Next)
-        {
-            New->Next->Prev = New;
-        }
+        List->Nodes[Node->Prev].Next = Node->Next;
+    }
+    else
+    {
+        List->Head = Node->Next;
     }
 
-    /* Update list tail if applicable */
-    if(Existing->Owner->Tail == Existing)
+    if(Node->Next != LL_NULL_HANDLE)
+    {
+        List->Nodes[Node->Next].Prev = Node->Prev;
+    }
+    else
     {
-        Existing->Owner->Tail = New;
+        List->Tail = Node->Prev;
     }
+
+    /* Put the node on the free list, NULL data marks it as free */
+    Node->Data = NULL;
+    Node->Next = List->FreeNodes;
+    List->FreeNodes = Handle;
+    List->Count--;
+
+    return LL_OK;
 }
 
-static void Static_RemoveInnerNode(ListNode_t* Node, ListNode_t* Prev)
+ListStatus_t LL_IndexGetCount(IndexList_t* List, unsigned int* Count)
 {
-    /* Bypass node (link fwd) */
-    Prev->Next = Node->Next;
-
-    if(Node->Owner->Linkage == LL_DOUBLE)
-    {
-        /* Bypass node (link backwards) */
-        Node->Next->Prev = Prev;
-    }
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Count));
+    *Count = List->Count;
 
-    /* Remove node */
-    Node->Owner->Count--;
-    free(Node);
+    return LL_OK;
 }
 
-List_t* LL_NewList(ListLinkage_t Linkage)
+ListStatus_t LL_IndexDeleteList(IndexList_t* List)
 {
-    List_t* List = NULL;
+    RETURN_LL_NOT_OK_IF(IS_NULL(List));
 
-    if((Linkage == LL_SINGLE || Linkage == LL_DOUBLE) && (List = malloc(sizeof(List_t))))
+    if(List->Nodes)
     {
-        List->Head = NULL;
-        List->Tail = NULL;
-        List->Count = 0;
-        List->Linkage = Linkage;
+        List->Allocator.Free(List->Nodes, List->Allocator.Ctx);
     }
+    List->Allocator.Free(List, List->Allocator.Ctx);
 
-    return List;
+    return LL_OK;
 }
 
 
-ListNode_t* LL_GetHead(List_t* List)
+/* ------------------------------------------------------------------------------------------------ */
+/* Unrolled lists */
+
+static void* Static_AlignedAlloc(const ListAllocator_t* Allocator, size_t Size)
 {
-    return (List ? List->Head : NULL);
-}
+    /* Allocate a bit more to start at a cache line boundary. The address given by the allocator is
+       stored just before the aligned one. */
+    char* Raw = Allocator->Alloc(Size + LL_CACHE_LINE_SIZE - 1 + sizeof(void*), Allocator->Ctx);
+    RETURN_NULL_IF(IS_NULL(Raw));
 
+    uintptr_t Aligned = ((uintptr_t)(Raw + sizeof(void*)) + LL_CACHE_LINE_SIZE - 1) &
+                        ~(uintptr_t)(LL_CACHE_LINE_SIZE - 1);
+    ((void**)Aligned)[-1] = Raw;
 
-ListNode_t* LL_GetTail(List_t* List)
-{
-    return (List ? List->Tail : NULL);
+    return (void*)Aligned;
 }
 
-
-ListNode_t* LL_GetNext(ListNode_t* Node)
+static void Static_AlignedFree(const ListAllocator_t* Allocator, void* Ptr)
 {
-    return (Node ? Node->Next : NULL);
+    Allocator->Free(((void**)Ptr)[-1], Allocator->Ctx);
 }
 
-
-ListNode_t* LL_GetPrev(ListNode_t* Node)
+static UnrolledBlock_t* Static_UnrolledNewBlock(UnrolledList_t* List, UnrolledBlock_t* Prev)
 {
-    return ((Node && (Node->Owner->Linkage == LL_DOUBLE)) ? Node->Prev : NULL);
-}
+    UnrolledBlock_t* Block = Static_AlignedAlloc(&List->Allocator, sizeof(UnrolledBlock_t));
 
+    if(Block)
+    {
+        /* Link the empty block after Prev, or to the front of the list */
+        Block->Count = 0;
+        Block->Next = (Prev ? Prev->Next : List->Head);
 
-void* LL_GetData(ListNode_t* Node)
-{
-    return (Node ? Node->Data : NULL);
-}
+        if(Prev)
+        {
+            Prev->Next = Block;
+        }
+        else
+        {
+            List->Head = Block;
+        }
 
+        if(List->Tail == Prev)
+        {
+            List->Tail = Block;
+        }
+    }
 
-ListNode_t* LL_GetNodeByData(List_t* List, void* Data)
-{
-    RETURN_NULL_IF(IS_NULL(Data) || IS_INVALID_OR_EMPTY(List)); 
-    return Static_GetNodeByData(List, Data);
+    return Block;
 }
 
-ListStatus_t LL_AddToFront(List_t* List, void* Data)
+static void Static_UnrolledInsert(UnrolledList_t* List, UnrolledBlock_t* Block, unsigned int Slot, void* Data)
 {
-    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data));
-
-    ListNode_t* Node = Static_NewNode();
-    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+    /* Make room at Slot, the block is known not to be full */
+    memmove(&Block->Data[Slot + 1], &Block->Data[Slot], (Block->Count - Slot) * sizeof(void*));
+    Block->Data[Slot] = Data;
+    Block->Count++;
+    List->Count++;
+}
 
-    /* Fwd link to old head */
-    Node->Next = List->Head;
+static ListStatus_t Static_UnrolledFind(UnrolledList_t* List, void* Data, UnrolledBlock_t** Block,
+                                        UnrolledBlock_t** Prev, unsigned int* Slot)
+{
+    UnrolledBlock_t* PrevBlock = NULL;
 
-    if(List->Head && (List->Linkage == LL_DOUBLE))
+    for(UnrolledBlock_t* Iter = List->Head; Iter; PrevBlock = Iter, Iter = Iter->Next)
     {
-        /* Bwd link from old head */
-        List->Head->Prev = Node;
+        for(unsigned int i = 0; i < Iter->Count; i++)
+        {
+            if(Iter->Data[i] == Data)
+            {
+                *Block = Iter;
+                *Prev = PrevBlock;
+                *Slot = i;
+                return LL_OK;
+            }
+        }
     }
 
-    /* Update head */
-    List->Head = Node;
+    return LL_NOT_OK;
+}
 
-    /* If the list was empty, update tail */
-    if(IS_EMPTY(List))
+static void Static_UnrolledFreeBlock(UnrolledList_t* List, UnrolledBlock_t* Block, UnrolledBlock_t* Prev)
+{
+    /* Unlink and free a block that was emptied */
+    if(Prev)
+    {
+        Prev->Next = Block->Next;
+    }
+    else
     {
-        List->Tail = Node;
+        List->Head = Block->Next;
     }
 
-    /* Update node data, owner list, count */
-    Node->Data = Data;
-    Node->Owner = List;
-    List->Count++;
+    if(List->Tail == Block)
+    {
+        List->Tail = Prev;
+    }
 
-    return LL_OK;
+    Static_AlignedFree(&List->Allocator, Block);
 }
 
-
-ListStatus_t LL_AddToBack(List_t* List, void* Data)
+static void Static_UnrolledRebalance(UnrolledList_t* List, UnrolledBlock_t* Block, UnrolledBlock_t* Prev)
 {
-    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data));
-
-    ListNode_t* Node = Static_NewNode();
-    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+    /* After a removal from Block, keep it at least half full: merge it with a neighbour if both fit
+       in one block, otherwise move elements from the fuller neighbour, which leaves both at least half
+       full. A block with no neighbours is only freed once it's empty. */
+    UnrolledBlock_t* Next = Block->Next;
 
-    /* Bwd link new node to old tail */
-    if(List->Linkage == LL_DOUBLE)
+    if(IS_NULL(Prev) && IS_NULL(Next))
     {
-        Node->Prev = List->Tail;
+        if(Block->Count == 0)
+        {
+            Static_UnrolledFreeBlock(List, Block, NULL);
+        }
     }
-
-    /* Fwd link from old tail */
-    if(List->Tail)
+    else if(Block->Count >= LL_UNROLLED_BLOCK_SIZE / 2)
+    {
+        return;
+    }
+    else if(Prev && (Prev->Count + Block->Count <= LL_UNROLLED_BLOCK_SIZE))
+    {
+        memcpy(&Prev->Data[Prev->Count], Block->Data, Block->Count * sizeof(void*));
+        Prev->Count += Block->Count;
+        Static_UnrolledFreeBlock(List, Block, Prev);
+    }
+    else if(Next && (Block->Count + Next->Count <= LL_UNROLLED_BLOCK_SIZE))
+    {
+        memcpy(&Block->Data[Block->Count], Next->Data, Next->Count * sizeof(void*));
+        Block->Count += Next->Count;
+        Static_UnrolledFreeBlock(List, Next, Block);
+    }
+    else if(Next && (IS_NULL(Prev) || (Next->Count >= Prev->Count)))
+    {
+        /* Take the first elements of the next block */
+        unsigned int NumMoved = (Next->Count - Block->Count) / 2;
+        memcpy(&Block->Data[Block->Count], Next->Data, NumMoved * sizeof(void*));
+        memmove(Next->Data, &Next->Data[NumMoved], (Next->Count - NumMoved) * sizeof(void*));
+        Block->Count += NumMoved;
+        Next->Count -= NumMoved;
+    }
+    else
     {
-        List->Tail->Next = Node;
+        /* Take the last elements of the prev block */
+        unsigned int NumMoved = (Prev->Count - Block->Count) / 2;
+        memmove(&Block->Data[NumMoved], Block->Data, Block->Count * sizeof(void*));
+        memcpy(Block->Data, &Prev->Data[Prev->Count - NumMoved], NumMoved * sizeof(void*));
+        Block->Count += NumMoved;
+        Prev->Count -= NumMoved;
     }
+}
+
+UnrolledList_t* LL_NewUnrolledList(void)
+{
+    return LL_NewUnrolledListWithAllocator(Static_DefaultAlloc, Static_DefaultFree, NULL);
+}
+
+UnrolledList_t* LL_NewUnrolledListWithAllocator(ListAllocFn_t Alloc, ListFreeFn_t Free, void* Ctx)
+{
+    RETURN_NULL_IF(IS_NULL(Alloc) || IS_NULL(Free));
 
-    /* Update Tail */
-    List->Tail = Node;
+    UnrolledList_t* List = Alloc(sizeof(UnrolledList_t), Ctx);
 
-    /* If the list was empty, update the head */
-    if(IS_EMPTY(List))
+    if(List)
     {
-        List->Head = Node;
+        List->Head = NULL;
+        List->Tail = NULL;
+        List->Count = 0;
+        List->Allocator.Alloc = Alloc;
+        List->Allocator.Free = Free;
+        List->Allocator.Ctx = Ctx;
     }
 
-    /* Update node data, owner list, count */
-    Node->Data = Data;
-    Node->Owner = List;
-    List->Count++;
-
-    return LL_OK;
+    return List;
 }
 
-
-ListStatus_t LL_InsertAfterNode(ListNode_t* Node, void* Data)
+ListStatus_t LL_UnrolledAddToFront(UnrolledList_t* List, void* Data)
 {
-    RETURN_LL_NOT_OK_IF(IS_NULL(Node) || IS_NULL(Data) || IS_INVALID_OR_EMPTY(Node->Owner));
-   
-    ListNode_t* NewNode = Static_NewNode();
-    RETURN_LL_NOT_OK_IF(IS_NULL(NewNode));
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data));
 
-    Static_InsertNewNodeAfterNode(NewNode, Node);
-    NewNode->Data = Data;
-    NewNode->Owner = Node->Owner;
-    NewNode->Owner->Count++;
+    UnrolledBlock_t* Block = List->Head;
+    if(IS_NULL(Block) || (Block->Count == LL_UNROLLED_BLOCK_SIZE))
+    {
+        Block = Static_UnrolledNewBlock(List, NULL);
+        RETURN_LL_NOT_OK_IF(IS_NULL(Block));
+    }
 
+    Static_UnrolledInsert(List, Block, 0, Data);
     return LL_OK;
 }
 
-ListStatus_t LL_SetData(ListNode_t* Node, void* Data)
+ListStatus_t LL_UnrolledAddToBack(UnrolledList_t* List, void* Data)
 {
-    RETURN_LL_NOT_OK_IF(IS_NULL(Node) || IS_NULL(Data) || IS_INVALID_OR_EMPTY(Node->Owner));
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data));
 
-    Node->Data = Data;
+    UnrolledBlock_t* Block = List->Tail;
+    if(IS_NULL(Block) || (Block->Count == LL_UNROLLED_BLOCK_SIZE))
+    {
+        Block = Static_UnrolledNewBlock(List, List->Tail);
+        RETURN_LL_NOT_OK_IF(IS_NULL(Block));
+    }
+
+    Static_UnrolledInsert(List, Block, Block->Count, Data);
     return LL_OK;
 }
 
-ListStatus_t LL_InsertAfterData(List_t* List, void* ExistingData, void* NewData)
-{   
-    RETURN_LL_NOT_OK_IF(IS_NULL(ExistingData) || IS_NULL(NewData) || IS_INVALID_OR_EMPTY(List));
-   
-    ListNode_t* Node = Static_GetNodeByData(List, ExistingData);
-    RETURN_LL_NOT_OK_IF(IS_NULL(Node));
+ListStatus_t LL_UnrolledInsertAfterData(UnrolledList_t* List, void* ExistingData, void* NewData)
+{
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(ExistingData) || IS_NULL(NewData));
 
-    ListNode_t* NewNode = Static_NewNode();
-    RETURN_LL_NOT_OK_IF(IS_NULL(NewNode));
+    UnrolledBlock_t* Block;
+    UnrolledBlock_t* Prev;
+    unsigned int Slot;
+    RETURN_LL_NOT_OK_IF(Static_UnrolledFind(List, ExistingData, &Block, &Prev, &Slot) != LL_OK);
+    Slot++;
+
+    if(Block->Count == LL_UNROLLED_BLOCK_SIZE)
+    {
+        /* Split the full block: the upper half moves to a new block that follows it */
+        UnrolledBlock_t* NewBlock = Static_UnrolledNewBlock(List, Block);
+        RETURN_LL_NOT_OK_IF(IS_NULL(NewBlock));
 
-    Static_InsertNewNodeAfterNode(NewNode, Node);
+        unsigned int Half = LL_UNROLLED_BLOCK_SIZE / 2;
+        NewBlock->Count = LL_UNROLLED_BLOCK_SIZE - Half;
+        Block->Count = Half;
+        memcpy(NewBlock->Data, &Block->Data[Half], NewBlock->Count * sizeof(void*));
 
-    NewNode->Data = NewData;
-    NewNode->Owner = Node->Owner;
-    List->Count++;
+        if(Slot > Half)
+        {
+            Block = NewBlock;
+            Slot -= Half;
+        }
+    }
 
+    Static_UnrolledInsert(List, Block, Slot, NewData);
     return LL_OK;
 }
 
-ListStatus_t LL_RemoveHead(List_t* List)
+ListStatus_t LL_UnrolledRemoveData(UnrolledList_t* List, void* Data)
 {
-    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
-    Static_RemoveHead(List);
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data));
+
+    UnrolledBlock_t* Block;
+    UnrolledBlock_t* Prev;
+    unsigned int Slot;
+    RETURN_LL_NOT_OK_IF(Static_UnrolledFind(List, Data, &Block, &Prev, &Slot) != LL_OK);
+
+    /* Close the gap */
+    Block->Count--;
+    List->Count--;
+    memmove(&Block->Data[Slot], &Block->Data[Slot + 1], (Block->Count - Slot) * sizeof(void*));
+    Static_UnrolledRebalance(List, Block, Prev);
 
     return LL_OK;
 }
 
-ListStatus_t LL_RemoveTail(List_t* List)
+ListStatus_t LL_UnrolledFindData(UnrolledList_t* List, void* Data, UnrolledCursor_t* Cursor)
 {
-    RETURN_LL_NOT_OK_IF(IS_INVALID_OR_EMPTY(List));
-    Static_RemoveTail(List);
-        
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Data) || IS_NULL(Cursor));
+
+    UnrolledBlock_t* Block;
+    UnrolledBlock_t* Prev;
+    unsigned int Slot;
+    RETURN_LL_NOT_OK_IF(Static_UnrolledFind(List, Data, &Block, &Prev, &Slot) != LL_OK);
+
+    Cursor->List = List;
+    Cursor->Block = Block;
+    Cursor->Slot = Slot;
+
     return LL_OK;
 }
 
-ListStatus_t LL_RemoveNode(ListNode_t* Node)
+ListStatus_t LL_UnrolledCursorToHead(UnrolledList_t* List, UnrolledCursor_t* Cursor)
 {
-    RETURN_LL_NOT_OK_IF(IS_NULL(Node) || IS_INVALID_OR_EMPTY(Node->Owner));
+    RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Cursor) || IS_NULL(List->Head));
 
-    if(Node == Node->Owner->Head)
-    {
-        Static_RemoveHead(Node->Owner);
-    }
-    else if(Node == Node->Owner->Tail)
-    {
-        Static_RemoveTail(Node->Owner);
-    }
-    else
-    {
-        /* Get prev node */
-        ListNode_t* Prev = (Node->Owner->Linkage == LL_DOUBLE ? Node->Prev : Static_GetPrevNode(Node));
-        RETURN_LL_NOT_OK_IF(IS_NULL(Prev));
+    Cursor->List = List;
+    Cursor->Block = List->Head;
+    Cursor->Slot = 0;
 
-        Static_RemoveInnerNode(Node, Prev);
-    }
-    
     return LL_OK;
 }
 
-ListStatus_t LL_RemoveNodeByData(List_t* List, void* Data)
+ListStatus_t LL_UnrolledCursorNext(UnrolledCursor_t* Cursor)
 {
-    RETURN_LL_NOT_OK_IF(IS_NULL(Data) || IS_INVALID_OR_EMPTY(List));
-    
-    if(List->Head->Data == Data)
+    RETURN_LL_NOT_OK_IF(IS_NULL(Cursor) || IS_NULL(Cursor->Block));
+
+    if(Cursor->Slot + 1 < Cursor->Block->Count)
     {
-        Static_RemoveHead(List);
+        Cursor->Slot++;
     }
     else
     {
-        ListNode_t* Prev = Static_GetPrevNodeByData(List, Data);
-        RETURN_LL_NOT_OK_IF(IS_NULL(Prev));
-
-        ListNode_t* Node = Prev->Next;
-        if(Node == List->Tail)
-        {
-            Static_RemoveTail(List);
-        }
-        else
-        {
-            Static_RemoveInnerNode(Node, Prev);
-        }
+        /* Blocks are never empty, so the next element is the first one of the next block */
+        RETURN_LL_NOT_OK_IF(IS_NULL(Cursor->Block->Next));
+        Cursor->Block = Cursor->Block->Next;
+        Cursor->Slot = 0;
     }
 
     return LL_OK;
 }
 
-ListStatus_t LL_GetCount(List_t* List, unsigned int* Count)
+void* LL_UnrolledCursorGetData(UnrolledCursor_t* Cursor)
+{
+    return ((Cursor && Cursor->Block && (Cursor->Slot < Cursor->Block->Count)) ?
+            Cursor->Block->Data[Cursor->Slot] : NULL);
+}
+
+ListStatus_t LL_UnrolledGetCount(UnrolledList_t* List, unsigned int* Count)
 {
     RETURN_LL_NOT_OK_IF(IS_NULL(List) || IS_NULL(Count));
     *Count = List->Count;
@@ -380,14 +4941,17 @@ ListStatus_t LL_GetCount(List_t* List, unsigned int* Count)
     return LL_OK;
 }
 
-ListStatus_t LL_DeleteList(List_t* List)
+ListStatus_t LL_UnrolledDeleteList(UnrolledList_t* List)
 {
     RETURN_LL_NOT_OK_IF(IS_NULL(List));
 
-    /* Remove any existing nodes first, then free list */
-    do {} while(LL_RemoveHead(List) == LL_OK);
-    free(List);
+    while(List->Head)
+    {
+        UnrolledBlock_t* Block = List->Head;
+        List->Head = Block->Next;
+        Static_AlignedFree(&List->Allocator, Block);
+    }
+    List->Allocator.Free(List, List->Allocator.Ctx);
 
     return LL_OK;
 }
-
@@ -1,26 +1,61 @@
 /* 
-    Create and manipulate singly and doubly linked lists. 
+    Create and manipulate singly, doubly and XOR linked lists. 
     Feel free to use the code in any way.
 
     Notes:
     - Internal structure of a list: List object -> Node objects -> Data
-    - A node's data is actually a void pointer to an object managed by the user.
+    - A node's data is actually a void pointer to an object managed by the user, except for inline
+      lists (see LL_NewInlineList), where a copy of the value is stored in the node itself.
     - Nodes contain a reference to the list they belong to, so functions like LL_RemoveNode(Node)
-      do not need a List argument.
-    - Memory for the inner structure of lists and nodes is dynamically allocated.
+      do not need a List argument. Nodes moved by LL_Concat or LL_MergeSorted keep referring to
+      their old list, which forwards them to the new one, so the moved nodes don't have to be
+      visited. The old list is released once no node refers to it: removed nodes let go of it, and
+      so do the nodes given to functions that change the list (such as LL_InsertAfterNode), which
+      then refer to the new list.
+      Reading nodes (LL_GetNext, LL_GetPrev, LL_GetData) changes nothing, so several threads can
+      read a list at once as long as none of them changes it.
+    - Memory for the inner structure of lists and nodes is dynamically allocated, with malloc/free
+      by default or with a user-provided allocator (see LL_NewListWithAllocator).
+    - Nodes are carved out of chunks owned by the list, like an arena: each chunk is twice the size
+      of the previous one (up to a limit) and nodes are handed out from it in order. Removed nodes
+      are kept on a free list for reuse. Once many nodes are free (LL_POOL_TRIM_MIN_FREE at least),
+      the chunks whose nodes are all free are given back to the allocator, so a list that grew then
+      shrank doesn't keep its peak memory; define LL_POOL_TRIM_MIN_FREE very large to keep every
+      chunk until LL_DeleteList, which frees them in one go without visiting the nodes. Lists that
+      exchange nodes (see LL_Splice) share the chunks of the exchanged nodes, which are released
+      with the last of them (these chunks are not given back earlier), but each list still takes
+      nodes from its own pool: such lists can be used by different threads, one thread per list, as
+      long as their allocator is thread-safe (malloc is).
     - LL_DeleteList(List) will free all the memory allocated internally for the list and its nodes.
 */
 
 #ifndef LINKED_LIST_H
 #define LINKED_LIST_H
 
-/* Type of linkage for a list: single or double. */
+#include <stddef.h>
+#include <stdint.h>
+
+/* Type of linkage for a list: single, double or XOR. Nodes of an XOR linked list have a single
+   link field (the address of the prev node XOR the address of the next node), so they are as small
+   as the nodes of a singly linked list, but the list can be traversed in both directions with a
+   cursor (see LL_CursorToHead). */
 typedef enum
 {
     LL_SINGLE,
-    LL_DOUBLE
+    LL_DOUBLE,
+    LL_XOR
 }ListLinkage_t;
 
+/* What LL_GetNodeByData does with the node it finds: nothing, move it to the front of the list, or
+   swap it with its prev node. The last two make frequently looked up data move towards the head,
+   so later lookups of that data visit fewer nodes. */
+typedef enum
+{
+    LL_LOOKUP_PLAIN,
+    LL_LOOKUP_MOVE_TO_FRONT,
+    LL_LOOKUP_TRANSPOSE
+}ListLookupPolicy_t;
+
 /* Type used to return the status of a function call. */
 typedef enum
 {
@@ -39,27 +74,130 @@ typedef enum
 /* Lists contain references to nodes, and nodes contain references to lists,
    so one of them has to be declared before defining the other. */
 typedef struct ListNode ListNode_t;
+typedef struct List List_t;
 
+/* User-provided allocation functions. Ctx is the context pointer given when creating the list. */
+typedef void* (*ListAllocFn_t)(size_t Size, void* Ctx);
+typedef void (*ListFreeFn_t)(void* Ptr, void* Ctx);
 
-/* A list object contains references to its first and last node,
-   the type of linkage (single or double) and the number of nodes. */
+/* User-provided comparison function for sorted lists. Returns a negative value if the data A comes
+   before the data B, 0 if they are equivalent, a positive value if A comes after B. */
+typedef int (*ListCompareFn_t)(const void* A, const void* B);
+
+/* User-provided function called by LL_ForEach for the data of each node. Ctx is the context
+   pointer given to LL_ForEach. Returns LL_TRUE to go on to the next node, LL_FALSE to stop. */
+typedef ListBool_t (*ListVisitFn_t)(void* Data, void* Ctx);
+
+
+/* Allocator used by a list for the list object itself and its node chunks. */
+typedef struct
+{
+    ListAllocFn_t Alloc;
+    ListFreeFn_t Free;
+    void* Ctx;
+}ListAllocator_t;
+
+
+/* Hash index of the nodes of a list by their data. Defined in linked_list.c. */
+typedef struct ListHashIndex ListHashIndex_t;
+
+
+/* Counters of the lookups by data done in a list: the number of lookups, how many found the data
+   and the total number of nodes compared to the data (nodes found through the hash index are not
+   compared). NumProbes / NumFound is roughly the average depth of the data that is looked up. */
+typedef struct
+{
+    uint64_t NumLookups;
+    uint64_t NumFound;
+    uint64_t NumProbes;
+}ListLookupStats_t;
+
+
+/* Position index of the nodes of a list (a skip list). Defined in linked_list.c. */
+typedef struct ListSkipIndex ListSkipIndex_t;
+
+
+/* Counting Bloom filter of the data of a list. Defined in linked_list.c. */
+typedef struct ListBloomFilter ListBloomFilter_t;
+
+
+/* Block of nodes allocated at once. Defined in linked_list.c. */
+typedef struct ListChunk ListChunk_t;
+
+
+/* Per-list node pool: the chunks allocated so far that only this list has nodes in (newest first)
+   and the last one, the nodes that are free for reuse and the last one, the part of the newest
+   chunk that was never used, the size of a node in bytes (which depends on the linkage of the
+   list), the number of nodes of the last chunk allocated, the number of free nodes, the number of
+   nodes of the chunks and the number of free nodes at which empty chunks are looked for. Free
+   nodes are linked through their Next field. */
 typedef struct
+{
+    ListChunk_t* Chunks;
+    ListChunk_t* LastChunk;
+    ListNode_t* FreeNodes;
+    ListNode_t* LastFreeNode;
+    char* Unused;
+    char* UnusedEnd;
+    size_t NodeSize;
+    unsigned int LastCapacity;
+    unsigned int NumFree;
+    unsigned int Capacity;
+    unsigned int TrimAt;
+}ListPool_t;
+
+
+/* Chunks shared by lists that exchanged nodes (see LL_Splice). Defined in linked_list.c. */
+typedef struct ListPoolGroup ListPoolGroup_t;
+
+
+/* A list object contains references to its first and last node,
+   the type of linkage (single, double or XOR), the number of nodes, the size of the values stored
+   in the nodes (0 if the nodes only refer to user data), the comparison function that keeps the
+   nodes in order (NULL if the list is not sorted), the lookup policy and counters, the hash index
+   of its nodes by data, the position index of its nodes and the Bloom filter of its data (NULL if
+   not enabled), the pool its nodes come from, the group of lists it shares node chunks with and
+   the allocator used for the pool, the indexes and the list object. A list merged into another one
+   by LL_Concat forwards its nodes to that list and is kept in its chain of absorbed lists until no
+   node and no other merged list refers to it (NumRefs counts them, NumForwarded counts the nodes
+   of a list that refer to lists merged into it). Contiguous is LL_TRUE while the nodes are known
+   to be consecutive in memory in list order (see LL_GetArrayView). */
+struct List
 {
     ListNode_t* Head;
     ListNode_t* Tail;
     unsigned int Count;
+    ListBool_t Contiguous;
     ListLinkage_t Linkage;
-}List_t;
+    size_t ElemSize;
+    ListCompareFn_t Compare;
+    ListLookupPolicy_t LookupPolicy;
+    ListLookupStats_t LookupStats;
+    ListHashIndex_t* HashIndex;
+    ListSkipIndex_t* SkipIndex;
+    ListBloomFilter_t* BloomFilter;
+    ListPool_t Pool;
+    ListPoolGroup_t* PoolGroup;
+    unsigned int NumRefs;
+    unsigned int NumForwarded;
+    List_t* Forward;
+    List_t* Absorbed;
+    List_t* PrevAbsorbed;
+    List_t* NextAbsorbed;
+    ListAllocator_t Allocator;
+};
 
 
 /* Nodes contain data (void pointers to objects managed by the user).
-   A node also contains information about the list it belongs to, and the next & prev nodes. */
+   A node also contains information about the list it belongs to, and the next & prev nodes.
+   For XOR linked lists, Next holds the XOR of the addresses of the prev and next nodes. Prev must
+   stay the last member: nodes of singly linked lists are allocated without it. */
 struct ListNode
 {
     List_t* Owner;
-    ListNode_t* Prev;
     ListNode_t* Next;
     void* Data;
+    ListNode_t* Prev;
 };
 
 
@@ -68,6 +206,33 @@ struct ListNode
 List_t* LL_NewList(ListLinkage_t Linkage);
 
 
+/* Same as LL_NewList, but all the memory of the list (the list object and its nodes) is allocated
+   with Alloc and released with Free. Ctx is passed unchanged to both functions. Returns NULL if
+   memory allocation fails or any of the arguments (except Ctx) is invalid. */
+List_t* LL_NewListWithAllocator(ListLinkage_t Linkage, ListAllocFn_t Alloc, ListFreeFn_t Free,
+                                void* Ctx);
+
+
+/* Creates an empty inline list object with the given linkage and returns a pointer to it. The
+   nodes of an inline list store a copy of an ElemSize-byte value, not a pointer to user data:
+   - functions that add data or set data copy ElemSize bytes from the given pointer into the node;
+   - LL_GetData returns a pointer to the value inside the node, valid until the node is removed;
+   - functions that look for data compare values (ElemSize bytes) instead of pointers.
+   Returns NULL if memory allocation fails or any of the arguments is invalid. */
+List_t* LL_NewInlineList(ListLinkage_t Linkage, size_t ElemSize);
+
+
+/* Creates an empty sorted list object with the given linkage and returns a pointer to it. The
+   nodes of a sorted list are kept in the order given by Compare: data is added with LL_Insert and
+   looked up by key with LL_Find and LL_LowerBound. Functions that add or set data at a given place
+   (LL_AddToFront, LL_AddToBack, LL_InsertAfterNode, LL_InsertAfterData, LL_InsertAt, LL_SetData)
+   return an error for sorted lists. A doubly linked sorted list has a position index (see
+   LL_EnablePositionIndex), so adding and looking up data take logarithmic time on average; other
+   sorted lists are walked from the head. Returns NULL if memory allocation fails or any of the
+   arguments is invalid. */
+List_t* LL_NewSortedList(ListLinkage_t Linkage, ListCompareFn_t Compare);
+
+
 /* Returns the head (first node) of a list, or NULL if the list is NULL or empty. */
 ListNode_t* LL_GetHead(List_t* List);
 
@@ -77,12 +242,14 @@ ListNode_t* LL_GetTail(List_t* List);
 
 
 /* Returns the node that comes after a given node. 
-   Returns NULL if the argument is a tail node or NULL. */
+   Returns NULL if the argument is a tail node or NULL, or if it belongs to an XOR linked list
+   (use a cursor to traverse those). */
 ListNode_t* LL_GetNext(ListNode_t* Node);
 
 
 /* Returns the node that comes before a given node. Returns NULL if the argument is NULL, if it
-   doesn't have a prev node, or if it doesn't belong to a doubly linked list */
+   doesn't have a prev node, or if it doesn't belong to a doubly linked list (use a cursor to
+   traverse XOR linked lists). */
 ListNode_t* LL_GetPrev(ListNode_t* Node);
 
 
@@ -96,6 +263,22 @@ void* LL_GetData(ListNode_t* Node);
 ListNode_t* LL_GetNodeByData(List_t* List, void* Data);
 
 
+/* Stores the nodes that contain the given data, in list order, into the array Nodes (at most
+   MaxNodes of them) and provides the number of nodes stored through the output parameter NumNodes.
+   The data pointers of the nodes are gathered in batches and compared several at a time (with AVX2
+   when the CPU supports it). Returns LL_OK on success. Returns an error if any of the arguments is
+   NULL. */
+ListStatus_t LL_FindAll(List_t* List, void* Data, ListNode_t** Nodes, unsigned int MaxNodes,
+                        unsigned int* NumNodes);
+
+
+/* Provides the number of nodes that contain the given data through the output parameter Count.
+   Takes constant time if the hash index is enabled (see LL_EnableHashIndex), otherwise the list is
+   searched like in LL_FindAll. Returns LL_OK on success. Returns an error if any of the arguments
+   is NULL. */
+ListStatus_t LL_CountMatches(List_t* List, void* Data, unsigned int* Count);
+
+
 /* Sets the data contained by the given node to the given data. Returns LL_OK on success.
    Returns an error if any of the arguments is NULL, or if the owner list of the node argument
    is NULL, invalid, or empty. */
@@ -114,6 +297,19 @@ ListStatus_t LL_AddToFront(List_t* List, void* Data);
 ListStatus_t LL_AddToBack(List_t* List, void* Data);
 
 
+/* Adds NumData nodes with the data in the given array to the front of the list, in array order.
+   The nodes are taken from the pool at once (the pool grows by a chunk big enough for all of them
+   if needed), linked to each other in one pass and linked into the list at once. Returns LL_OK on
+   success, also if NumData is 0. Returns an error if the list or the array is NULL, if any of the
+   data pointers is NULL, if the list is sorted or if memory allocation fails; the list is not
+   changed then. */
+ListStatus_t LL_AddArrayToFront(List_t* List, void* const* Data, unsigned int NumData);
+
+
+/* Same as LL_AddArrayToFront, but the nodes are added to the back of the list. */
+ListStatus_t LL_AddArrayToBack(List_t* List, void* const* Data, unsigned int NumData);
+
+
 /* Creates a new node containing the given data and inserts it after the given node.
    Returns LL_OK on success. Returns an error if any of the arguments is NULL,
    if the list referenced by the node argument is NULL, invalid or empty, or the memory
@@ -134,31 +330,679 @@ ListStatus_t LL_RemoveHead(List_t* List);
 
 
 /* Removes the tail node from the given list. Returns LL_OK on success. Returns an error
-   if the list argument is NULL, invalid or empty. */
+   if the list argument is NULL, invalid or empty. For singly linked lists this walks the list
+   to find the new tail: to drain a singly linked list from the back, see LL_Reverse. */
 ListStatus_t LL_RemoveTail(List_t* List);
 
 
 /* Removes the given node from the list that it belongs to. Returns LL_OK on success.
    Returns an error if the node argument is NULL, if the list that the node belongs to is NULL,
-   invalid or empty, or if the given node is not found. */
+   invalid or empty, or if the given node is not found. In singly linked lists, a node that is not
+   the tail takes the data (or the value) of its next node, and the next node is removed instead,
+   in constant time: Node stays valid and a node pointer to the next node becomes invalid. For the
+   tail of a singly linked list, and for XOR linked lists, this walks the list to find the prev
+   node, use LL_RemoveAfterNode or LL_CursorRemove to avoid that. */
 ListStatus_t LL_RemoveNode(ListNode_t* Node);
 
 
+/* Removes the node that comes after the given node, in constant time for singly and doubly linked
+   lists. Returns LL_OK on success. Returns an error if the node argument is NULL, if the list that
+   the node belongs to is NULL, invalid or empty, or if the given node is the tail. */
+ListStatus_t LL_RemoveAfterNode(ListNode_t* Node);
+
+
 /* Removes the first node from the given list that contains the given data. Returns LL_OK
    on success. Returns an error if the list argument is NULL, invalid or empty, if the data
    argument is NULL, or if the data is not found in the list. */
 ListStatus_t LL_RemoveNodeByData(List_t* List, void* Data);
 
 
+/* Moves all the nodes of Src to the back of Dest and deletes Src, which must not be used
+   afterwards. The moved nodes are not visited: they keep referring to Src, which forwards them to
+   Dest, so this takes constant time (plus the time to add the nodes to the indexes of Dest, if it
+   has any). Dest takes over the node chunks of Src; if Src shared chunks with other lists (see
+   LL_Splice), Dest shares them for good, in its place. Both lists must have the same linkage,
+   value size and allocator, and Dest must not be sorted. Returns LL_OK if successful, LL_NOT_OK
+   otherwise. */
+ListStatus_t LL_Concat(List_t* Dest, List_t* Src);
+
+
+/* Moves the nodes from First to Last (both in the same list, First not after Last) to Dest, after
+   the node After, or to the front of Dest if After is NULL. Dest can be the list of the nodes, as
+   long as After is not one of them. The nodes are relinked, not copied, so the two lists share
+   node chunks from then on, for good: they join a group whose chunks are released with the last
+   list of the group, even if the nodes are moved back, and the lists of a group don't give empty
+   chunks back early (see the notes at the top). Takes time proportional to the number of moved
+   nodes (their count and owner change), plus the time to find the nodes before First and after
+   After in singly and XOR linked lists. Both lists must have the same linkage, value size and
+   allocator, and Dest must not be sorted. Returns LL_OK if successful, LL_NOT_OK otherwise. */
+ListStatus_t LL_Splice(List_t* Dest, ListNode_t* After, ListNode_t* First, ListNode_t* Last);
+
+
+/* Moves the nodes after Node to a new list, returned through NewList (an empty list if Node is the
+   tail). The nodes are relinked, not copied, so the two lists share their node chunks from then on
+   (see LL_Splice). The new list has the same linkage, value size, allocator, comparison function
+   and lookup policy as the list of Node, and a position index if that list is sorted and doubly
+   linked (so its ordered inserts stay logarithmic), but no hash index or Bloom filter. Takes time
+   proportional to the number of moved nodes, plus the time to find the prev node of Node in XOR
+   linked lists.
+   Returns LL_OK if successful, LL_NOT_OK otherwise. */
+ListStatus_t LL_SplitAfter(ListNode_t* Node, List_t** NewList);
+
+
+/* Splits a list into NumLists lists, keeping the order of the nodes: the lengths of the lists
+   differ by at most one and the longer ones come first. List keeps the first part and is stored in
+   Lists[0], the other parts are moved to new lists (as with LL_SplitAfter) stored in Lists[1] to
+   Lists[NumLists - 1]. Takes time proportional to the number of nodes of List, plus the time to
+   index the moved nodes in the parts of a sorted list. The parts can then be used by different
+   threads at the same time, one thread per part. Returns LL_OK if successful, LL_NOT_OK otherwise
+   (List is then unchanged). */
+ListStatus_t LL_SplitInto(List_t* List, unsigned int NumLists, List_t** Lists);
+
+
 /* Provides the number of nodes in the given list through the output parameter Count. 
    Returns LL_OK on success. Returns an error if any of the arguments is NULL. */
 ListStatus_t LL_GetCount(List_t* List, unsigned int* Count);
 
 
-/* Deallocates the memory used internally for the list and all of its nodes. Returns LL_OK
-   on success. Returns an error if the list argument is NULL. After calling this function, the list
-   pointer should be reinitialized to NULL to avoid accessing memory that is not allocated. */
+/* Adds a node with the given data to a sorted list, after the nodes that come before it or are
+   equivalent to it. Returns LL_OK on success. Returns an error if any of the arguments is NULL, if
+   the list is not sorted or if memory allocation fails. */
+ListStatus_t LL_Insert(List_t* List, void* Data);
+
+
+/* Returns the first node of a sorted list whose data is equivalent to Key, according to the list's
+   comparison function. Returns NULL if there is no such node, if any of the arguments is NULL or
+   if the list is not sorted. */
+ListNode_t* LL_Find(List_t* List, void* Key);
+
+
+/* Returns the first node of a sorted list whose data does not come before Key, according to the
+   list's comparison function. Returns NULL if there is no such node, if any of the arguments is
+   NULL or if the list is not sorted. */
+ListNode_t* LL_LowerBound(List_t* List, void* Key);
+
+
+/* Sorts the nodes of a list in the order given by Compare. The sort is stable: nodes with
+   equivalent data keep their relative order. It's a bottom-up merge sort that relinks the nodes,
+   so it allocates no memory and takes O(n log n) comparisons; the position index, if enabled, is
+   updated in place. Returns LL_OK on success. Returns an error if any of the arguments is NULL or
+   if the list is a sorted list (see LL_NewSortedList), which is always in the order of its own
+   comparison function. */
+ListStatus_t LL_Sort(List_t* List, ListCompareFn_t Compare);
+
+
+/* Reverses the order of the nodes of a list, in constant time for XOR linked lists and in linear
+   time otherwise. The position index, if enabled, is updated. A singly linked list can't find the
+   node before its tail without walking from the head, so draining it with LL_RemoveTail takes
+   quadratic time. Reversing it once and draining it from the head takes linear time in total:
+
+       LL_Reverse(List);
+       for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetHead(List))
+       {
+           Use(LL_GetData(Node));
+           LL_RemoveHead(List);
+       }
+
+   Returns LL_OK on success (also for an empty list). Returns an error if the list is NULL or is a
+   sorted list. */
+ListStatus_t LL_Reverse(List_t* List);
+
+
+/* Sorts the nodes of a list like LL_Sort, with NumThreads threads (0 for one thread per
+   processor). Each thread sorts a segment of the list, then the sorted segments are cut into as
+   many pieces by sampled splitters and each thread merges one piece of every segment, so the nodes
+   are relinked in place. Each thread sorts at least 16384 nodes and at most 64 threads are used:
+   shorter lists are sorted by fewer threads, or by the calling thread only. The sort is stable,
+   the result is the same as with LL_Sort; data equal to a splitter is cut by position, so
+   duplicates are spread over the threads too. Compare is called from several threads at once, on
+   different data: it must not change shared state without synchronization. Uses Windows or POSIX
+   threads (link with -pthread); on other platforms, or when the library is built with
+   LL_NO_THREADS, the list is sorted by the calling thread. Returns LL_OK on success. Returns an
+   error if the list or Compare is NULL or if the list is a sorted list. */
+ListStatus_t LL_ParallelSort(List_t* List, ListCompareFn_t Compare, unsigned int NumThreads);
+
+
+/* Merges NumLists lists, each already sorted in the order given by Compare, into Out and deletes
+   them: they must not be used afterwards. Out may have sorted nodes of its own. The nodes are
+   relinked, not copied, with a heap of the first node of each list, so this takes O(n log k)
+   comparisons for n nodes in k lists and allocates no memory (except for the indexes of Out, if it
+   has any). As with LL_Concat, the moved nodes keep referring to their old lists, which forward
+   them to Out. The merge is stable: on equivalent data, the nodes of Out come first, then those of
+   Lists[0], Lists[1] and so on. All the lists must have the same linkage, value size and allocator
+   as Out, and Out must not be sorted, unless Compare is its comparison function. Returns LL_OK if
+   successful, LL_NOT_OK otherwise (also if a list is NULL, is Out or is given twice), in which
+   case no list is changed. */
+ListStatus_t LL_MergeSorted(List_t** Lists, unsigned int NumLists, ListCompareFn_t Compare,
+                            List_t* Out);
+
+
+/* Returns the node at the given index (0 for the head). Takes logarithmic time on average if the
+   position index is enabled (see LL_EnablePositionIndex), linear time otherwise (doubly linked
+   lists are walked from the closer end). Returns NULL if the list is NULL or if the index is out
+   of range. */
+ListNode_t* LL_GetNodeAt(List_t* List, unsigned int Index);
+
+
+/* Provides the index of the given node (0 for the head) through the output parameter Index. Takes
+   logarithmic time on average if the position index is enabled, linear time otherwise. Returns
+   LL_OK on success. Returns an error if any of the arguments is NULL or if the node is not in its
+   list. */
+ListStatus_t LL_GetNodeIndex(ListNode_t* Node, unsigned int* Index);
+
+
+/* Inserts a node with the given data at the given index, so that it ends up at that index. An
+   index equal to the count of the list adds the node to the back. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL, if the index is greater than the count, or if
+   memory allocation fails. */
+ListStatus_t LL_InsertAt(List_t* List, unsigned int Index, void* Data);
+
+
+/* Removes the node at the given index. Returns LL_OK on success. Returns an error if the list is
+   NULL or empty, or if the index is out of range. */
+ListStatus_t LL_RemoveAt(List_t* List, unsigned int Index);
+
+
+/* A cursor points to a node of a list and remembers the node that comes before it, so it can move
+   through XOR linked lists, where a node alone is not enough to find its neighbours. Cursors work
+   with any linkage, but singly linked lists can only be traversed forward. A cursor is invalidated
+   when its node or the node before it is removed. */
+typedef struct
+{
+    List_t* List;
+    ListNode_t* Prev;
+    ListNode_t* Node;
+}ListCursor_t;
+
+
+/* Points the cursor to the head of the given list. Returns LL_OK on success. Returns an error if
+   any of the arguments is NULL, or if the list is invalid or empty (the cursor then points to
+   NULL). */
+ListStatus_t LL_CursorToHead(List_t* List, ListCursor_t* Cursor);
+
+
+/* Points the cursor to the tail of the given list. Returns LL_OK on success. Returns an error if
+   any of the arguments is NULL, or if the list is invalid or empty (the cursor then points to
+   NULL). This has to walk the whole list for singly linked lists. */
+ListStatus_t LL_CursorToTail(List_t* List, ListCursor_t* Cursor);
+
+
+/* Moves the cursor to the next node. Returns LL_OK on success. Returns an error, leaving the
+   cursor unchanged, if the cursor is NULL or invalid, or if it points to the tail of the list. */
+ListStatus_t LL_CursorNext(ListCursor_t* Cursor);
+
+
+/* Moves the cursor to the prev node. Returns LL_OK on success. Returns an error, leaving the
+   cursor unchanged, if the cursor is NULL or invalid, if it points to the head of the list, or if
+   the list is singly linked. */
+ListStatus_t LL_CursorPrev(ListCursor_t* Cursor);
+
+
+/* Returns the node that the cursor points to, or NULL if the cursor is NULL. */
+ListNode_t* LL_CursorGetNode(ListCursor_t* Cursor);
+
+
+/* Removes the node that the cursor points to, in constant time whatever the linkage of the list,
+   and moves the cursor to the next node (NULL if the tail was removed). Returns LL_OK on success.
+   Returns an error if the cursor is NULL or invalid. Filtering a list in one pass:
+
+       ListStatus_t Status = LL_CursorToHead(List, &Cursor);
+       while(Status == LL_OK)
+       {
+           Status = (ShouldRemove(LL_GetData(LL_CursorGetNode(&Cursor))) ?
+                     LL_CursorRemove(&Cursor) : LL_CursorNext(&Cursor));
+           Status = (LL_CursorGetNode(&Cursor) ? Status : LL_NOT_OK);
+       }
+*/
+ListStatus_t LL_CursorRemove(ListCursor_t* Cursor);
+
+
+/* Number of nodes between the node visited by LL_ForEach (or read by LL_ToArray) and the node
+   whose data is prefetched. Only used by linked_list.c, so define it when compiling that file. */
+#ifndef LL_PREFETCH_DISTANCE
+#define LL_PREFETCH_DISTANCE    8
+#endif
+
+
+/* Calls Visit for the data of each node of the list, from head to tail, until Visit returns
+   LL_FALSE. While Visit runs, the node LL_PREFETCH_DISTANCE positions ahead and its data are
+   prefetched, so the cache misses on the data overlap with the work done by Visit. If the nodes
+   are consecutive in memory (see LL_GetArrayView) the lookahead node is found by its address,
+   otherwise by following its links one step ahead of the prefetch, so the misses on the nodes
+   themselves stay serial: with the nodes in random order a traversal is bound by the memory
+   latency (see bench/foreach_bench.c). Visit must not add or remove nodes of the list. Returns
+   LL_OK on success (also for an empty list). Returns an error if the list or Visit is NULL. */
+ListStatus_t LL_ForEach(List_t* List, ListVisitFn_t Visit, void* Ctx);
+
+
+/* Same as LL_ForEach, but from tail to head. Returns an error for singly linked lists. */
+ListStatus_t LL_ForEachReverse(List_t* List, ListVisitFn_t Visit, void* Ctx);
+
+
+/* Stores the data of the nodes of a list, from head to tail, into the array Data (at most MaxData
+   of them) and provides the number of data pointers stored through the output parameter NumData.
+   For inline lists, the pointers refer to the values inside the nodes. The nodes are read in one
+   pass, with the nodes LL_PREFETCH_DISTANCE positions ahead prefetched. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL. */
+ListStatus_t LL_ToArray(List_t* List, void** Data, unsigned int MaxData, unsigned int* NumData);
+
+
+/* Creates a list with the given linkage that contains the data of the array Data, in order. All
+   the nodes are taken from a single allocation. Returns NULL if memory allocation fails or any of
+   the arguments (or data pointers) is invalid. */
+List_t* LL_FromArray(ListLinkage_t Linkage, void* const* Data, unsigned int NumData);
+
+
+/* View of the data of a list as an array, without copying: the nodes are consecutive in memory, so
+   the Data field of the node at index i is Stride bytes after the one of the node at index i - 1.
+   LL_VIEW_DATA(View, i) is the data of the node at index i. */
+typedef struct
+{
+    char* Data;
+    size_t Stride;
+    unsigned int Count;
+}ListArrayView_t;
+
+#define LL_VIEW_DATA(View, Index)   (*(void**)((View)->Data + (size_t)(Index) * (View)->Stride))
+
+
+/* Provides a view of the data of a list through the output parameter View, if the nodes of the
+   list are consecutive in memory in list order. That's the case for a list created by
+   LL_FromArray, and it stays so while nodes are only removed from the ends of the list and added
+   to its back right after the tail in memory (where new nodes go until a node chunk is full or a
+   removed node is reused). The view is valid until nodes are added, removed or moved. Takes
+   constant time. Returns LL_OK on success (also for an empty list). Returns an error if any of the
+   arguments is NULL, or if the nodes are not known to be consecutive. */
+ListStatus_t LL_GetArrayView(List_t* List, ListArrayView_t* View);
+
+
+/* Enables a hash index of the list's nodes by data, built from the nodes already in the list and
+   kept up to date by all functions that add, remove or set data. Lookups by data
+   (LL_GetNodeByData, LL_InsertAfterData, LL_RemoveNodeByData) then take constant time on average,
+   except when the data is in several nodes, where the first one is looked for by traversing the
+   list. Removals still walk the list to find the prev node in singly and XOR linked lists. The
+   index takes 48 to 96 bytes per distinct data pointer on 64-bit targets. Returns LL_OK on
+   success, or if the index was already enabled. Returns an error if the list argument is NULL or
+   is an inline list, if a singly or XOR linked list has a lookup policy other than LL_LOOKUP_PLAIN
+   (see LL_SetLookupPolicy), or if memory allocation fails. */
+ListStatus_t LL_EnableHashIndex(List_t* List);
+
+
+/* Enables a counting Bloom filter of the list's data, built from the nodes already in the list and
+   kept up to date by all functions that add, remove or set data. Lookups by data
+   (LL_GetNodeByData, LL_InsertAfterData, LL_RemoveNodeByData, LL_FindAll, LL_CountMatches) then
+   fail or find nothing without visiting any node when the data is not in the list, except for
+   about 3% false positives. The filter takes 8 to 16 bytes per node, and is rebuilt twice as big
+   when the list outgrows it. Returns LL_OK on success, or if the filter was already enabled.
+   Returns an error if the list argument is NULL or is an inline list, or if memory allocation
+   fails. */
+ListStatus_t LL_EnableBloomFilter(List_t* List);
+
+
+/* Sets what LL_GetNodeByData does with the node it finds (see ListLookupPolicy_t), LL_LOOKUP_PLAIN
+   by default. Moving the node costs constant time, except that swapping it with its prev node
+   walks the list again in singly linked lists. Returns LL_OK on success. Returns an error if the
+   list is NULL, if the policy is invalid, if a sorted list would be reordered, or if a singly or
+   XOR linked list has a hash index (finding the prev node of the nodes it finds would walk the
+   list). */
+ListStatus_t LL_SetLookupPolicy(List_t* List, ListLookupPolicy_t Policy);
+
+
+/* Provides the lookup counters of the list (see ListLookupStats_t) through the output parameter
+   Stats. All lookups by data are counted, whatever the lookup policy. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL. */
+ListStatus_t LL_GetLookupStats(List_t* List, ListLookupStats_t* Stats);
+
+
+/* Sets the lookup counters of the list to 0. Returns LL_OK on success. Returns an error if the
+   list argument is NULL. */
+ListStatus_t LL_ResetLookupStats(List_t* List);
+
+
+/* Enables a position index of a doubly linked list: a skip list over about one node in four, where
+   each link knows how many nodes it skips. It's built from the nodes already in the list and kept
+   up to date by all functions that add or remove nodes, which then take logarithmic time on
+   average instead of constant time. LL_GetNodeAt, LL_GetNodeIndex, LL_InsertAt and LL_RemoveAt
+   then take logarithmic time on average. The index takes about 12 bytes per node, plus its hash
+   table, on 64-bit targets. Returns LL_OK on success, or if the index was already enabled. Returns
+   an error if the list argument is NULL or is not a doubly linked list, or if memory allocation
+   fails. */
+ListStatus_t LL_EnablePositionIndex(List_t* List);
+
+
+/* Removes all the nodes of a list, which stays valid and empty (the indexes enabled for it stay
+   enabled). The nodes are not visited: the newest node chunk is kept for the next nodes and the
+   other chunks are released. If the list shares chunks with other lists (see LL_Splice), its nodes
+   go back to its free list in one batch instead. Returns LL_OK if successful, LL_NOT_OK if List is
+   NULL. */
+ListStatus_t LL_Clear(List_t* List);
+
+
+/* Deallocates the memory used internally for the list and all of its nodes. The node chunks are
+   released as a whole, so the cost depends on the number of chunks, not on the number of nodes
+   (the chunks that the list shares with other lists are released with the last of them).
+   Returns LL_OK on success. Returns an error if the list argument is NULL. After calling this
+   function, the list pointer should be reinitialized to NULL to avoid accessing memory that is not
+   allocated. */
 ListStatus_t LL_DeleteList(List_t* List);
 
+
+
+/* --------------------------------------------------------------------------------------------- */
+/* Intrusive lists: the links are embedded in the user's objects, so adding and removing objects
+   does not allocate anything. Intrusive lists are always doubly linked. A link can be in only one
+   list at a time. Use LL_CONTAINER_OF to get back from a link to the object that contains it:
+
+       typedef struct { int Id; ListLink_t Link; } Item_t;
+       Item_t* Item = LL_CONTAINER_OF(LL_IntrusiveGetHead(&List), Item_t, Link);
+*/
+
+/* Links to be embedded in user objects. */
+typedef struct ListLink ListLink_t;
+struct ListLink
+{
+    ListLink_t* Prev;
+    ListLink_t* Next;
+};
+
+
+/* An intrusive list object contains references to its first and last link and the number of links.
+   It can be embedded in user objects too, LL_IntrusiveInit must be called before using it. */
+typedef struct
+{
+    ListLink_t* Head;
+    ListLink_t* Tail;
+    unsigned int Count;
+}IntrusiveList_t;
+
+
+/* Returns a pointer to the object of the given type that contains the given link as the given
+   member. */
+#define LL_CONTAINER_OF(Link, Type, Member)     ((Type*)((char*)(Link) - offsetof(Type, Member)))
+
+
+/* Initializes an intrusive list object as an empty list. Returns LL_OK on success.
+   Returns an error if the list argument is NULL. */
+ListStatus_t LL_IntrusiveInit(IntrusiveList_t* List);
+
+
+/* Returns the first link of an intrusive list, or NULL if the list is NULL or empty. */
+ListLink_t* LL_IntrusiveGetHead(IntrusiveList_t* List);
+
+
+/* Returns the last link of an intrusive list, or NULL if the list is NULL or empty. */
+ListLink_t* LL_IntrusiveGetTail(IntrusiveList_t* List);
+
+
+/* Returns the link that comes after the given link, or NULL if the argument is a tail link or
+   NULL. */
+ListLink_t* LL_IntrusiveGetNext(ListLink_t* Link);
+
+
+/* Returns the link that comes before the given link, or NULL if the argument is a head link or
+   NULL. */
+ListLink_t* LL_IntrusiveGetPrev(ListLink_t* Link);
+
+
+/* Inserts the given link to the front of the list. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL. */
+ListStatus_t LL_IntrusiveAddToFront(IntrusiveList_t* List, ListLink_t* Link);
+
+
+/* Inserts the given link to the back of the list. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL. */
+ListStatus_t LL_IntrusiveAddToBack(IntrusiveList_t* List, ListLink_t* Link);
+
+
+/* Inserts the given link after an existing link of the list. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL or the list is empty. */
+ListStatus_t LL_IntrusiveInsertAfter(IntrusiveList_t* List, ListLink_t* Existing,
+                                     ListLink_t* Link);
+
+
+/* Removes the given link from the list. The object that contains the link is not touched
+   otherwise. Returns LL_OK on success. Returns an error if any of the arguments is NULL, if the
+   list is empty, or if the link is obviously not part of the list. */
+ListStatus_t LL_IntrusiveRemove(IntrusiveList_t* List, ListLink_t* Link);
+
+
+/* Provides the number of links in the given list through the output parameter Count.
+   Returns LL_OK on success. Returns an error if any of the arguments is NULL. */
+ListStatus_t LL_IntrusiveGetCount(IntrusiveList_t* List, unsigned int* Count);
+
+
+
+/* --------------------------------------------------------------------------------------------- */
+/* Index lists: doubly linked lists whose nodes live in one growable array and link to each other
+   with 32-bit indices instead of pointers. A node takes 16 bytes instead of 32 on 64-bit targets,
+   traversal stays within one dense block of memory, and the whole list is relocatable: the node
+   array can be copied or written out as is. Nodes are referred to by handles (indices), which stay
+   valid when the array grows. Removed nodes are kept on a free list and reused. */
+
+/* Handle of a node in an index list. */
+typedef uint32_t ListHandle_t;
+
+/* Handle value that doesn't refer to any node (like NULL for node pointers). */
+#define LL_NULL_HANDLE  ((ListHandle_t)0xFFFFFFFFu)
+
+
+/* Node of an index list. Free nodes have NULL data and are linked through their Next field. */
+typedef struct
+{
+    ListHandle_t Prev;
+    ListHandle_t Next;
+    void* Data;
+}IndexNode_t;
+
+
+/* An index list object contains the node array, its capacity, the number of array entries that
+   were ever used, the head of the free list, the first and last node, the number of nodes and the
+   allocator of the list object and its node array. */
+typedef struct
+{
+    IndexNode_t* Nodes;
+    uint32_t Capacity;
+    uint32_t Used;
+    ListHandle_t FreeNodes;
+    ListHandle_t Head;
+    ListHandle_t Tail;
+    unsigned int Count;
+    ListAllocator_t Allocator;
+}IndexList_t;
+
+
+/* Creates an empty index list object and returns a pointer to it.
+   Returns NULL if memory allocation fails. */
+IndexList_t* LL_NewIndexList(void);
+
+
+/* Same as LL_NewIndexList, but the list object and its node array are allocated with Alloc and
+   released with Free (see LL_NewListWithAllocator). The array grows by allocating a bigger one and
+   copying the nodes. Returns NULL if memory allocation fails or Alloc or Free is NULL. */
+IndexList_t* LL_NewIndexListWithAllocator(ListAllocFn_t Alloc, ListFreeFn_t Free, void* Ctx);
+
+
+/* Makes sure the node array of the list can hold at least Capacity nodes without growing.
+   Returns LL_OK on success. Returns an error if the list argument is NULL, or if memory
+   allocation fails. */
+ListStatus_t LL_IndexReserve(IndexList_t* List, uint32_t Capacity);
+
+
+/* Returns the handle of the head (first node) of a list, or LL_NULL_HANDLE if the list is NULL or
+   empty. */
+ListHandle_t LL_IndexGetHead(IndexList_t* List);
+
+
+/* Returns the handle of the tail (last node) of a list, or LL_NULL_HANDLE if the list is NULL or
+   empty. */
+ListHandle_t LL_IndexGetTail(IndexList_t* List);
+
+
+/* Returns the handle of the node that comes after the given node. Returns LL_NULL_HANDLE if the
+   list is NULL, if the handle is invalid, or if it refers to the tail node. */
+ListHandle_t LL_IndexGetNext(IndexList_t* List, ListHandle_t Handle);
+
+
+/* Returns the handle of the node that comes before the given node. Returns LL_NULL_HANDLE if the
+   list is NULL, if the handle is invalid, or if it refers to the head node. */
+ListHandle_t LL_IndexGetPrev(IndexList_t* List, ListHandle_t Handle);
+
+
+/* Returns the data of the given node. Returns NULL if the list is NULL or the handle is
+   invalid. */
+void* LL_IndexGetData(IndexList_t* List, ListHandle_t Handle);
+
+
+/* Returns the handle of the first node that contains the given data. Returns LL_NULL_HANDLE if
+   any of the arguments is NULL, if the list is empty, or if the data is not found in the list. */
+ListHandle_t LL_IndexGetHandleByData(IndexList_t* List, void* Data);
+
+
+/* Sets the data of the given node. Returns LL_OK on success. Returns an error if any of the
+   arguments is NULL or the handle is invalid. */
+ListStatus_t LL_IndexSetData(IndexList_t* List, ListHandle_t Handle, void* Data);
+
+
+/* Inserts a new node containing the given data to the front of the list. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL, or if the node array can't grow. */
+ListStatus_t LL_IndexAddToFront(IndexList_t* List, void* Data);
+
+
+/* Inserts a new node containing the given data to the back of the list. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL, or if the node array can't grow. */
+ListStatus_t LL_IndexAddToBack(IndexList_t* List, void* Data);
+
+
+/* Inserts a new node containing the given data after the given node. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL, if the handle is invalid, or if the node
+   array can't grow. */
+ListStatus_t LL_IndexInsertAfter(IndexList_t* List, ListHandle_t Handle, void* Data);
+
+
+/* Removes the given node from the list. Its handle can be reused by later insertions. Returns
+   LL_OK on success. Returns an error if the list argument is NULL or the handle is invalid. */
+ListStatus_t LL_IndexRemove(IndexList_t* List, ListHandle_t Handle);
+
+
+/* Provides the number of nodes in the given list through the output parameter Count.
+   Returns LL_OK on success. Returns an error if any of the arguments is NULL. */
+ListStatus_t LL_IndexGetCount(IndexList_t* List, unsigned int* Count);
+
+
+/* Deallocates the memory used internally for the list and its node array. Returns LL_OK on
+   success. Returns an error if the list argument is NULL. */
+ListStatus_t LL_IndexDeleteList(IndexList_t* List);
+
+
+
+/* --------------------------------------------------------------------------------------------- */
+/* Unrolled lists: each node (block) holds up to LL_UNROLLED_BLOCK_SIZE data pointers, so
+   traversals and searches visit one block per LL_UNROLLED_BLOCK_SIZE elements, and the data
+   pointers of a block are contiguous in memory. Blocks are split when an insertion finds them
+   full. A block that a removal leaves less than half full is merged with its prev or next block if
+   they fit in one, otherwise it takes elements from the fuller of the two. So every block except
+   the first and the last one is at least half full. */
+
+/* Number of data pointers in a block. The default makes a block 128 bytes (two cache lines) on
+   64-bit targets. Blocks start at a cache line boundary (LL_CACHE_LINE_SIZE in linked_list.c), for
+   which each one takes up to one cache line and a pointer more from the allocator. */
+#ifndef LL_UNROLLED_BLOCK_SIZE
+#define LL_UNROLLED_BLOCK_SIZE  14
+#endif
+
+
+/* Block of an unrolled list: the next block, the number of used slots and the data pointers. */
+typedef struct UnrolledBlock UnrolledBlock_t;
+struct UnrolledBlock
+{
+    UnrolledBlock_t* Next;
+    unsigned int Count;
+    void* Data[LL_UNROLLED_BLOCK_SIZE];
+};
+
+
+/* An unrolled list object contains references to its first and last block, the number of elements
+   and the allocator of the list object and its blocks. */
+typedef struct
+{
+    UnrolledBlock_t* Head;
+    UnrolledBlock_t* Tail;
+    unsigned int Count;
+    ListAllocator_t Allocator;
+}UnrolledList_t;
+
+
+/* A cursor points to an element (a block and a slot in it) of an unrolled list. It's invalidated
+   by any insertion or removal. */
+typedef struct
+{
+    UnrolledList_t* List;
+    UnrolledBlock_t* Block;
+    unsigned int Slot;
+}UnrolledCursor_t;
+
+
+/* Creates an empty unrolled list object and returns a pointer to it.
+   Returns NULL if memory allocation fails. */
+UnrolledList_t* LL_NewUnrolledList(void);
+
+
+/* Same as LL_NewUnrolledList, but the list object and its blocks are allocated with Alloc and
+   released with Free (see LL_NewListWithAllocator). Returns NULL if memory allocation fails or
+   Alloc or Free is NULL. */
+UnrolledList_t* LL_NewUnrolledListWithAllocator(ListAllocFn_t Alloc, ListFreeFn_t Free, void* Ctx);
+
+
+/* Inserts the given data to the front of the list. Returns LL_OK on success. Returns an error
+   if any of the arguments is NULL, or if memory allocation for a new block fails. */
+ListStatus_t LL_UnrolledAddToFront(UnrolledList_t* List, void* Data);
+
+
+/* Inserts the given data to the back of the list. Returns LL_OK on success. Returns an error
+   if any of the arguments is NULL, or if memory allocation for a new block fails. */
+ListStatus_t LL_UnrolledAddToBack(UnrolledList_t* List, void* Data);
+
+
+/* Inserts NewData after the first element that is equal to ExistingData. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL, if ExistingData is not found in the list, or
+   if memory allocation for a new block fails. */
+ListStatus_t LL_UnrolledInsertAfterData(UnrolledList_t* List, void* ExistingData, void* NewData);
+
+
+/* Removes the first element that is equal to the given data. Returns LL_OK on success.
+   Returns an error if any of the arguments is NULL, or if the data is not found in the list. */
+ListStatus_t LL_UnrolledRemoveData(UnrolledList_t* List, void* Data);
+
+
+/* Points the cursor to the first element that is equal to the given data. Returns LL_OK on
+   success. Returns an error if any of the arguments is NULL, or if the data is not found in the
+   list. */
+ListStatus_t LL_UnrolledFindData(UnrolledList_t* List, void* Data, UnrolledCursor_t* Cursor);
+
+
+/* Points the cursor to the first element of the list. Returns LL_OK on success. Returns an error
+   if any of the arguments is NULL, or if the list is empty. */
+ListStatus_t LL_UnrolledCursorToHead(UnrolledList_t* List, UnrolledCursor_t* Cursor);
+
+
+/* Moves the cursor to the next element. Returns LL_OK on success. Returns an error, leaving the
+   cursor unchanged, if the cursor is NULL or invalid, or if it points to the last element. */
+ListStatus_t LL_UnrolledCursorNext(UnrolledCursor_t* Cursor);
+
+
+/* Returns the data of the element that the cursor points to, or NULL if the cursor is NULL or
+   invalid. */
+void* LL_UnrolledCursorGetData(UnrolledCursor_t* Cursor);
+
+
+/* Provides the number of elements in the given list through the output parameter Count.
+   Returns LL_OK on success. Returns an error if any of the arguments is NULL. */
+ListStatus_t LL_UnrolledGetCount(UnrolledList_t* List, unsigned int* Count);
+
+
+/* Deallocates the memory used internally for the list and all of its blocks. Returns LL_OK on
+   success. Returns an error if the list argument is NULL. */
+ListStatus_t LL_UnrolledDeleteList(UnrolledList_t* List);
+
 #endif /* LINKED_LIST_H */
 
@@ -1,6 +1,18 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "linked_list.h"
 
+#if defined(_WIN32)
+#include <windows.h>
+typedef HANDLE TestThread_t;
+typedef CRITICAL_SECTION TestMutex_t;
+#else
+#include <pthread.h>
+typedef pthread_t TestThread_t;
+typedef pthread_mutex_t TestMutex_t;
+#endif
+
 typedef struct TestData
 {
     int Id;
@@ -8,6 +20,36 @@ typedef struct TestData
     char* Name[10];
 }TestData_t;
 
+/* Object with an embedded link, to be used in intrusive lists */
+typedef struct TestItem
+{
+    int Id;
+    ListLink_t Link;
+}TestItem_t;
+
+/* Allocator context used to check that lists use the allocator they were given */
+typedef struct TestAllocator
+{
+    unsigned int NumAllocs;
+    unsigned int NumFrees;
+}TestAllocator_t;
+
+/* Allocator context shared by threads, the counts are updated under the mutex */
+typedef struct TestSharedAllocator
+{
+    TestAllocator_t Counts;
+    TestMutex_t Mutex;
+}TestSharedAllocator_t;
+
+/* Work of a thread that uses its own list, and the number of calls that failed */
+typedef struct TestWorker
+{
+    List_t* List;
+    unsigned int NumErrors;
+}TestWorker_t;
+
+typedef void (*TestThreadFn_t)(TestWorker_t* Worker);
+
 /* Test helper functions */
 static void TestStart(const char* const Header);
 static void TestEnd(void);
@@ -23,6 +65,17 @@ static void ExpectListWith2Nodes(List_t* List, int Id1, int Id2);
 static void ExpectListWith3Nodes(List_t* List, int Id1, int Id2, int Id3);
 static void ExpectListWith4Nodes(List_t* List, int Id1, int Id2, int Id3, int Id4);
 static void ExpectListWith5Nodes(List_t* List, int Id1, int Id2, int Id3, int Id4, int Id5);
+static void ExpectListWithIds(List_t* List, const int* Ids, unsigned int NumIds);
+static void* TestAlloc(size_t Size, void* Ctx);
+static void TestFree(void* Ptr, void* Ctx);
+static void* TestSharedAlloc(size_t Size, void* Ctx);
+static void TestSharedFree(void* Ptr, void* Ctx);
+static void RunWorkers(TestThreadFn_t Fn, TestWorker_t* Workers, unsigned int NumWorkers);
+static void ChurnSplitPart(TestWorker_t* Worker);
+static void ReadMergedList(TestWorker_t* Worker);
+static int CompareInts(const void* A, const void* B);
+static int CompareIntsDescending(const void* A, const void* B);
+static ListBool_t CollectIds(void* Data, void* Ctx);
 
 /* Test report variables */
 unsigned int NumFailedSubpoints = 0;
@@ -900,7 +953,45 @@ int main(void)
         ExpectEqualPtr(LL_GetPrev(LL_GetTail(DList)), LL_GetHead(DList));
         ExpectPtrNull(LL_GetPrev(LL_GetHead(DList)));
         ExpectPtrNull(LL_GetNext(LL_GetTail(DList)));
-        
+
+        /* Test 10: A node of an s-list that isn't the tail takes the data of the next node, which is removed */
+        ExpectResponse(LL_Clear(SList), LL_OK);
+        ExpectResponse(LL_EnableHashIndex(SList), LL_OK);
+        ExpectResponse(LL_EnableBloomFilter(SList), LL_OK);
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            ExpectResponse(LL_AddToBack(SList, &TestData[i]), LL_OK);
+        }
+        Middle = LL_GetNext(LL_GetHead(SList));
+        ListNode_t* Tail = LL_GetTail(SList);
+        ExpectResponse(LL_RemoveNode(Middle), LL_OK);
+        ExpectEqual(SList->Count, 4);
+        ExpectEqualPtr(LL_GetData(Middle), &TestData[2]);
+        ExpectEqualPtr(LL_GetNodeByData(SList, &TestData[2]), Middle);
+        ExpectPtrNull(LL_GetNodeByData(SList, &TestData[1]));
+        ExpectEqualPtr(LL_GetTail(SList), Tail);
+        ListNode_t* Next = LL_GetNext(Middle);
+        ExpectResponse(LL_RemoveNode(Next), LL_OK);
+        ExpectEqualPtr(LL_GetTail(SList), Next);
+        ExpectEqualPtr(LL_GetData(Next), &TestData[4]);
+        ExpectResponse(LL_RemoveNode(Middle), LL_OK);
+        ExpectListWith2Nodes(SList, TestData[0].Id, TestData[4].Id);
+        ExpectEqualPtr(LL_GetNext(LL_GetHead(SList)), LL_GetTail(SList));
+        ExpectEqualPtr(LL_GetTail(SList), Middle);
+        ExpectEqualPtr(LL_GetNodeByData(SList, &TestData[4]), Middle);
+
+        /* Test 11: The same with the values stored in the nodes */
+        List_t* IList = LL_NewInlineList(LL_SINGLE, sizeof(int));
+        for(int i = 0; i < 3; i++)
+        {
+            ExpectResponse(LL_AddToBack(IList, &i), LL_OK);
+        }
+        ExpectResponse(LL_RemoveNode(LL_GetHead(IList)), LL_OK);
+        ExpectEqual(*(int*)LL_GetData(LL_GetHead(IList)), 1);
+        ExpectEqual(*(int*)LL_GetData(LL_GetTail(IList)), 2);
+        ExpectEqual(IList->Count, 2);
+        ExpectResponse(LL_DeleteList(IList), LL_OK);
+
         ExpectResponse(LL_DeleteList(SList), LL_OK);
         ExpectResponse(LL_DeleteList(DList), LL_OK);
     }
@@ -1153,6 +1244,2431 @@ int main(void)
         ExpectResponse(LL_AddToFront(DList, &TestData[1]), LL_OK);
         ExpectResponse(LL_AddToFront(DList, &TestData[2]), LL_OK);
         ExpectResponse(LL_DeleteList(DList), LL_OK);
+
+        /* Test 8: A large list is released in a few chunks, not node by node */
+        TestAllocator_t Allocator = {0};
+        DList = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        for(unsigned int i = 0; i < 100000; i++)
+        {
+            ExpectResponse(LL_AddToBack(DList, &DummyData), LL_OK);
+        }
+        ExpectEqual(Allocator.NumAllocs < 20, LL_TRUE);
+        ExpectResponse(LL_DeleteList(DList), LL_OK);
+        ExpectEqual(Allocator.NumFrees, Allocator.NumAllocs);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 19: Node pool Tests");
+    {
+        /* Test 1: A removed node is reused by the next insertion */
+        List_t* List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+        ListNode_t* OldHead = LL_GetHead(List);
+        ExpectResponse(LL_RemoveHead(List), LL_OK);
+        ExpectResponse(LL_AddToFront(List, &TestData[2]), LL_OK);
+        ExpectEqualPtr(LL_GetHead(List), OldHead);
+        ExpectListWith2Nodes(List, 103, 102);
+
+        /* Test 2: Lists grow past one chunk of nodes */
+        for(unsigned int i = 0; i < 3 * 64; i++)
+        {
+            ExpectResponse(LL_AddToBack(List, &DummyData), LL_OK);
+        }
+        unsigned int Count;
+        ExpectResponse(LL_GetCount(List, &Count), LL_OK);
+        ExpectEqual(Count, 3 * 64 + 2);
+
+        /* Test 3: Draining and refilling the list keeps it consistent */
+        do {} while(LL_RemoveTail(List) == LL_OK);
+        ExpectEmptyList(List);
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[2]), LL_OK);
+        ExpectListWith3Nodes(List, 101, 102, 103);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        /* Test 4: Nodes of singly linked lists are allocated without the Prev field */
+        List = LL_NewList(LL_SINGLE);
+        for(unsigned int i = 0; i < 3 * 64; i++)
+        {
+            ExpectResponse(LL_AddToBack(List, &DummyData), LL_OK);
+        }
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+        ListNode_t* Node = LL_GetNodeByData(List, &TestData[0]);
+        ExpectEqual((unsigned int)((char*)LL_GetNext(Node) - (char*)Node), (unsigned int)offsetof(ListNode_t, Prev));
+        ExpectResponse(LL_RemoveNodeByData(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_InsertAfterNode(LL_GetHead(List), &TestData[2]), LL_OK);
+        ExpectEqualPtr(LL_GetNext(LL_GetHead(List)), Node);
+        ExpectPtrNull(LL_GetPrev(Node));
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 20: LL_NewListWithAllocator Tests");
+    {
+        TestAllocator_t Allocator = {0};
+
+        /* Test 1: Invalid arguments should return NULL */
+        ExpectPtrNull(LL_NewListWithAllocator(LL_DOUBLE, NULL, TestFree, &Allocator));
+        ExpectPtrNull(LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, NULL, &Allocator));
+        ExpectPtrNull(LL_NewListWithAllocator(5, TestAlloc, TestFree, &Allocator));
+        ExpectEqual(Allocator.NumAllocs, 0);
+
+        /* Test 2: The list object is allocated with the given allocator */
+        List_t* List = LL_NewListWithAllocator(LL_SINGLE, TestAlloc, TestFree, &Allocator);
+        ExpectEmptyList(List);
+        ExpectEqual(Allocator.NumAllocs, 1);
+
+        /* Test 3: Nodes are allocated with the given allocator */
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+        ExpectResponse(LL_InsertAfterData(List, &TestData[0], &TestData[2]), LL_OK);
+        ExpectListWith3Nodes(List, 101, 103, 102);
+        ExpectEqual(Allocator.NumAllocs > 1, LL_TRUE);
+        ExpectEqual(Allocator.NumFrees, 0);
+
+        /* Test 4: Everything allocated is released with the given allocator */
+        ExpectResponse(LL_RemoveNodeByData(List, &TestData[2]), LL_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        ExpectEqual(Allocator.NumFrees, Allocator.NumAllocs);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 21: Intrusive list Tests");
+    {
+        TestItem_t Items[3] = {{.Id = 101}, {.Id = 102}, {.Id = 103}};
+        IntrusiveList_t List;
+        unsigned int Count;
+
+        /* Test 1: NULL arguments should fail */
+        ExpectResponse(LL_IntrusiveInit(NULL), LL_NOT_OK);
+        ExpectResponse(LL_IntrusiveAddToBack(NULL, &Items[0].Link), LL_NOT_OK);
+        ExpectResponse(LL_IntrusiveAddToFront(&List, NULL), LL_NOT_OK);
+
+        /* Test 2: A new list is empty */
+        ExpectResponse(LL_IntrusiveInit(&List), LL_OK);
+        ExpectPtrNull(LL_IntrusiveGetHead(&List));
+        ExpectPtrNull(LL_IntrusiveGetTail(&List));
+        ExpectResponse(LL_IntrusiveRemove(&List, &Items[0].Link), LL_NOT_OK);
+        ExpectResponse(LL_IntrusiveInsertAfter(&List, &Items[0].Link, &Items[1].Link), LL_NOT_OK);
+
+        /* Test 3: Add links to front, back and after another link */
+        ExpectResponse(LL_IntrusiveAddToBack(&List, &Items[1].Link), LL_OK);
+        ExpectResponse(LL_IntrusiveAddToFront(&List, &Items[0].Link), LL_OK);
+        ExpectResponse(LL_IntrusiveInsertAfter(&List, &Items[1].Link, &Items[2].Link), LL_OK);
+        ExpectResponse(LL_IntrusiveGetCount(&List, &Count), LL_OK);
+        ExpectEqual(Count, 3);
+
+        /* Test 4: Traverse forward and backward, getting back to the objects */
+        ListLink_t* Link = LL_IntrusiveGetHead(&List);
+        ExpectEqual(LL_CONTAINER_OF(Link, TestItem_t, Link)->Id, 101);
+        Link = LL_IntrusiveGetNext(Link);
+        ExpectEqual(LL_CONTAINER_OF(Link, TestItem_t, Link)->Id, 102);
+        Link = LL_IntrusiveGetNext(Link);
+        ExpectEqual(LL_CONTAINER_OF(Link, TestItem_t, Link)->Id, 103);
+        ExpectEqualPtr(Link, LL_IntrusiveGetTail(&List));
+        ExpectPtrNull(LL_IntrusiveGetNext(Link));
+        ExpectEqualPtr(LL_IntrusiveGetPrev(LL_IntrusiveGetPrev(Link)), LL_IntrusiveGetHead(&List));
+        ExpectPtrNull(LL_IntrusiveGetPrev(LL_IntrusiveGetHead(&List)));
+
+        /* Test 5: Remove inner, head and tail links */
+        ExpectResponse(LL_IntrusiveRemove(&List, &Items[1].Link), LL_OK);
+        ExpectResponse(LL_IntrusiveRemove(&List, &Items[1].Link), LL_NOT_OK); /* not in the list anymore */
+        ExpectEqualPtr(LL_IntrusiveGetNext(&Items[0].Link), &Items[2].Link);
+        ExpectEqualPtr(LL_IntrusiveGetPrev(&Items[2].Link), &Items[0].Link);
+        ExpectResponse(LL_IntrusiveRemove(&List, &Items[0].Link), LL_OK);
+        ExpectEqualPtr(LL_IntrusiveGetHead(&List), &Items[2].Link);
+        ExpectResponse(LL_IntrusiveRemove(&List, &Items[2].Link), LL_OK);
+        ExpectPtrNull(LL_IntrusiveGetHead(&List));
+        ExpectPtrNull(LL_IntrusiveGetTail(&List));
+        ExpectResponse(LL_IntrusiveGetCount(&List, &Count), LL_OK);
+        ExpectEqual(Count, 0);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 22: XOR linked list Tests");
+    {
+        /* Test 1: Create an empty XOR linked list */
+        List_t* XList = LL_NewList(LL_XOR);
+        ExpectEmptyList(XList);
+        ExpectEqual((unsigned int)XList->Linkage, (unsigned int)LL_XOR);
+
+        /* Test 2: Nodes are as small as the nodes of singly linked lists */
+        ExpectResponse(LL_AddToBack(XList, &TestData[1]), LL_OK);
+        ExpectResponse(LL_AddToBack(XList, &TestData[3]), LL_OK);
+        ExpectEqual((unsigned int)((char*)LL_GetTail(XList) - (char*)LL_GetHead(XList)), (unsigned int)offsetof(ListNode_t, Prev));
+
+        /* Test 3: Nodes don't link to their neighbours directly */
+        ExpectPtrNull(LL_GetNext(LL_GetHead(XList)));
+        ExpectPtrNull(LL_GetPrev(LL_GetTail(XList)));
+
+        /* Test 4: Add, insert and traverse in both directions */
+        ExpectResponse(LL_AddToFront(XList, &TestData[0]), LL_OK);
+        ExpectResponse(LL_InsertAfterData(XList, &TestData[1], &TestData[2]), LL_OK);
+        ExpectResponse(LL_InsertAfterNode(LL_GetTail(XList), &TestData[4]), LL_OK);
+        ExpectListWithIds(XList, (int[]){101, 102, 103, 104, 105}, 5);
+        ExpectEqualPtr(LL_GetData(LL_GetNodeByData(XList, &TestData[3])), &TestData[3]);
+
+        /* Test 5: Remove inner, head and tail nodes */
+        ExpectResponse(LL_RemoveNodeByData(XList, &TestData[2]), LL_OK);
+        ExpectListWithIds(XList, (int[]){101, 102, 104, 105}, 4);
+        ExpectResponse(LL_RemoveNode(LL_GetNodeByData(XList, &TestData[3])), LL_OK);
+        ExpectListWithIds(XList, (int[]){101, 102, 105}, 3);
+        ExpectResponse(LL_RemoveTail(XList), LL_OK);
+        ExpectListWithIds(XList, (int[]){101, 102}, 2);
+        ExpectResponse(LL_RemoveHead(XList), LL_OK);
+        ExpectListWithIds(XList, (int[]){102}, 1);
+        ExpectResponse(LL_RemoveNodeByData(XList, &TestData[1]), LL_OK);
+        ExpectEmptyList(XList);
+
+        ExpectResponse(LL_DeleteList(XList), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 23: Cursor Tests");
+    {
+        ListCursor_t Cursor;
+
+        /* Test 1: NULL arguments and empty lists should fail */
+        List_t* List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_CursorToHead(NULL, &Cursor), LL_NOT_OK);
+        ExpectResponse(LL_CursorToHead(List, NULL), LL_NOT_OK);
+        ExpectResponse(LL_CursorToHead(List, &Cursor), LL_NOT_OK);
+        ExpectResponse(LL_CursorToTail(List, &Cursor), LL_NOT_OK);
+        ExpectResponse(LL_CursorNext(NULL), LL_NOT_OK);
+        ExpectResponse(LL_CursorPrev(NULL), LL_NOT_OK);
+        ExpectPtrNull(LL_CursorGetNode(NULL));
+
+        /* Test 2: Singly linked lists can only be traversed forward */
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[2]), LL_OK);
+        ExpectListWithIds(List, (int[]){101, 102, 103}, 3);
+        ExpectResponse(LL_CursorToTail(List, &Cursor), LL_OK);
+        ExpectEqualPtr(LL_CursorGetNode(&Cursor), LL_GetTail(List));
+        ExpectResponse(LL_CursorPrev(&Cursor), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        /* Test 3: Doubly linked lists can be traversed both ways */
+        List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+        ExpectListWithIds(List, (int[]){101, 102}, 2);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 24: Index list Tests");
+    {
+        unsigned int Count;
+
+        /* Test 1: NULL and invalid arguments should fail */
+        ExpectResponse(LL_IndexAddToBack(NULL, &TestData[0]), LL_NOT_OK);
+        ExpectEqual(LL_IndexGetHead(NULL), LL_NULL_HANDLE);
+        ExpectResponse(LL_IndexDeleteList(NULL), LL_NOT_OK);
+
+        /* Test 2: A new list is empty */
+        IndexList_t* List = LL_NewIndexList();
+        ExpectPtrNotNull(List);
+        ExpectEqual(LL_IndexGetHead(List), LL_NULL_HANDLE);
+        ExpectEqual(LL_IndexGetTail(List), LL_NULL_HANDLE);
+        ExpectResponse(LL_IndexAddToBack(List, NULL), LL_NOT_OK);
+        ExpectResponse(LL_IndexRemove(List, 0), LL_NOT_OK);
+        ExpectResponse(LL_IndexInsertAfter(List, 0, &TestData[0]), LL_NOT_OK);
+
+        /* Test 3: Add, insert and traverse in both directions */
+        ExpectResponse(LL_IndexAddToBack(List, &TestData[1]), LL_OK);
+        ExpectResponse(LL_IndexAddToFront(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_IndexAddToBack(List, &TestData[4]), LL_OK);
+        ExpectResponse(LL_IndexInsertAfter(List, LL_IndexGetHandleByData(List, &TestData[1]), &TestData[2]), LL_OK);
+        ExpectResponse(LL_IndexInsertAfter(List, LL_IndexGetHandleByData(List, &TestData[2]), &TestData[3]), LL_OK);
+        ExpectResponse(LL_IndexGetCount(List, &Count), LL_OK);
+        ExpectEqual(Count, 5);
+        ListHandle_t Handle = LL_IndexGetHead(List);
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            ExpectEqualPtr(LL_IndexGetData(List, Handle), &TestData[i]);
+            Handle = LL_IndexGetNext(List, Handle);
+        }
+        ExpectEqual(Handle, LL_NULL_HANDLE);
+        Handle = LL_IndexGetTail(List);
+        for(unsigned int i = 5; i > 0; i--)
+        {
+            ExpectEqualPtr(LL_IndexGetData(List, Handle), &TestData[i - 1]);
+            Handle = LL_IndexGetPrev(List, Handle);
+        }
+        ExpectEqual(Handle, LL_NULL_HANDLE);
+
+        /* Test 4: Remove nodes, removed handles become invalid and are reused */
+        Handle = LL_IndexGetHandleByData(List, &TestData[2]);
+        ExpectResponse(LL_IndexRemove(List, Handle), LL_OK);
+        ExpectResponse(LL_IndexRemove(List, Handle), LL_NOT_OK);
+        ExpectPtrNull(LL_IndexGetData(List, Handle));
+        ExpectResponse(LL_IndexSetData(List, Handle, &TestData[2]), LL_NOT_OK);
+        ExpectResponse(LL_IndexRemove(List, LL_IndexGetHead(List)), LL_OK);
+        ExpectResponse(LL_IndexRemove(List, LL_IndexGetTail(List)), LL_OK);
+        ExpectEqualPtr(LL_IndexGetData(List, LL_IndexGetHead(List)), &TestData[1]);
+        ExpectEqualPtr(LL_IndexGetData(List, LL_IndexGetTail(List)), &TestData[3]);
+        ExpectResponse(LL_IndexAddToBack(List, &DummyData), LL_OK);
+        ExpectEqual(LL_IndexGetTail(List) < 5, LL_TRUE);
+        ExpectResponse(LL_IndexSetData(List, LL_IndexGetTail(List), &TestData[4]), LL_OK);
+        ExpectEqualPtr(LL_IndexGetData(List, LL_IndexGetTail(List)), &TestData[4]);
+
+        /* Test 5: Handles stay valid when the node array grows */
+        Handle = LL_IndexGetHandleByData(List, &TestData[3]);
+        for(unsigned int i = 0; i < 1000; i++)
+        {
+            ExpectResponse(LL_IndexAddToFront(List, &DummyData), LL_OK);
+        }
+        ExpectEqualPtr(LL_IndexGetData(List, Handle), &TestData[3]);
+        ExpectEqualPtr(LL_IndexGetData(List, LL_IndexGetNext(List, Handle)), &TestData[4]);
+        ExpectResponse(LL_IndexGetCount(List, &Count), LL_OK);
+        ExpectEqual(Count, 1003);
+
+        ExpectResponse(LL_IndexDeleteList(List), LL_OK);
+
+        /* Test 6: The list object and its node array use the given allocator */
+        TestAllocator_t Allocator = {0, 0};
+        ExpectPtrNull(LL_NewIndexListWithAllocator(TestAlloc, NULL, &Allocator));
+        List = LL_NewIndexListWithAllocator(TestAlloc, TestFree, &Allocator);
+        ExpectPtrNotNull(List);
+        for(unsigned int i = 0; i < 100; i++)
+        {
+            ExpectResponse(LL_IndexAddToBack(List, &TestData[i % 5]), LL_OK);
+        }
+        ExpectResponse(LL_IndexReserve(List, 1000), LL_OK);
+        ExpectEqualPtr(LL_IndexGetData(List, LL_IndexGetTail(List)), &TestData[4]);
+        ExpectEqual(Allocator.NumAllocs > 2, LL_TRUE);
+        ExpectEqual(Allocator.NumFrees, Allocator.NumAllocs - 2);
+        ExpectResponse(LL_IndexDeleteList(List), LL_OK);
+        ExpectEqual(Allocator.NumFrees, Allocator.NumAllocs);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 25: Unrolled list Tests");
+    {
+        TestData_t Items[100];
+        UnrolledCursor_t Cursor;
+        unsigned int Count;
+
+        /* Test 1: NULL arguments and empty lists should fail */
+        ExpectResponse(LL_UnrolledAddToBack(NULL, &TestData[0]), LL_NOT_OK);
+        UnrolledList_t* List = LL_NewUnrolledList();
+        ExpectPtrNotNull(List);
+        ExpectResponse(LL_UnrolledAddToFront(List, NULL), LL_NOT_OK);
+        ExpectResponse(LL_UnrolledCursorToHead(List, &Cursor), LL_NOT_OK);
+        ExpectResponse(LL_UnrolledRemoveData(List, &TestData[0]), LL_NOT_OK);
+        ExpectResponse(LL_UnrolledInsertAfterData(List, &TestData[0], &TestData[1]), LL_NOT_OK);
+
+        /* Test 2: Fill several blocks from both ends and in the middle */
+        for(unsigned int i = 0; i < 100; i++)
+        {
+            Items[i].Id = (int)i;
+        }
+        for(unsigned int i = 40; i < 60; i++)
+        {
+            ExpectResponse(LL_UnrolledAddToBack(List, &Items[i]), LL_OK);
+        }
+        for(unsigned int i = 40; i > 0; i--)
+        {
+            ExpectResponse(LL_UnrolledAddToFront(List, &Items[i - 1]), LL_OK);
+        }
+        ExpectResponse(LL_UnrolledAddToBack(List, &Items[99]), LL_OK);
+        for(unsigned int i = 98; i >= 60; i--)
+        {
+            ExpectResponse(LL_UnrolledInsertAfterData(List, &Items[59], &Items[i]), LL_OK);
+        }
+        ExpectResponse(LL_UnrolledGetCount(List, &Count), LL_OK);
+        ExpectEqual(Count, 100);
+
+        /* Test 3: Elements are in order and blocks respect their capacity */
+        ExpectResponse(LL_UnrolledCursorToHead(List, &Cursor), LL_OK);
+        for(unsigned int i = 0; i < 100; i++)
+        {
+            ExpectEqual(((TestData_t*)LL_UnrolledCursorGetData(&Cursor))->Id, i);
+            ExpectResponse(LL_UnrolledCursorNext(&Cursor), (i < 99 ? LL_OK : LL_NOT_OK));
+        }
+        Count = 0;
+        for(UnrolledBlock_t* Block = List->Head; Block; Block = Block->Next)
+        {
+            ExpectEqual(Block->Count > 0 && Block->Count <= LL_UNROLLED_BLOCK_SIZE, LL_TRUE);
+            Count += Block->Count;
+        }
+        ExpectEqual(Count, 100);
+
+        /* Test 4: Find data */
+        ExpectResponse(LL_UnrolledFindData(List, &Items[77], &Cursor), LL_OK);
+        ExpectEqualPtr(LL_UnrolledCursorGetData(&Cursor), &Items[77]);
+        ExpectResponse(LL_UnrolledFindData(List, &DummyData, &Cursor), LL_NOT_OK);
+
+        /* Test 5: Remove every other element, then all of them */
+        for(unsigned int i = 0; i < 100; i += 2)
+        {
+            ExpectResponse(LL_UnrolledRemoveData(List, &Items[i]), LL_OK);
+        }
+        ExpectResponse(LL_UnrolledRemoveData(List, &Items[0]), LL_NOT_OK);
+        ExpectResponse(LL_UnrolledCursorToHead(List, &Cursor), LL_OK);
+        for(unsigned int i = 1; i < 100; i += 2)
+        {
+            ExpectEqual(((TestData_t*)LL_UnrolledCursorGetData(&Cursor))->Id, i);
+            LL_UnrolledCursorNext(&Cursor);
+        }
+        for(UnrolledBlock_t* Block = List->Head; Block; Block = Block->Next)
+        {
+            ExpectEqual((Block == List->Head) || (Block == List->Tail) || (Block->Count >= LL_UNROLLED_BLOCK_SIZE / 2), LL_TRUE);
+        }
+        for(unsigned int i = 1; i < 100; i += 2)
+        {
+            ExpectResponse(LL_UnrolledRemoveData(List, &Items[i]), LL_OK);
+        }
+        ExpectResponse(LL_UnrolledGetCount(List, &Count), LL_OK);
+        ExpectEqual(Count, 0);
+        ExpectPtrNull(List->Head);
+        ExpectPtrNull(List->Tail);
+
+        ExpectResponse(LL_UnrolledDeleteList(List), LL_OK);
+
+        /* Test 6: Blocks other than the first and last stay at least half full whatever is removed, are
+           aligned to a cache line and use the given allocator */
+        static TestData_t Many[1000];
+        TestAllocator_t Allocator = {0, 0};
+        ExpectPtrNull(LL_NewUnrolledListWithAllocator(NULL, TestFree, &Allocator));
+        List = LL_NewUnrolledListWithAllocator(TestAlloc, TestFree, &Allocator);
+        ExpectResponse(LL_UnrolledAddToBack(List, &Many[0]), LL_OK);
+        for(unsigned int i = 1; i < 1000; i++)
+        {
+            ExpectResponse((i % 3 ? LL_UnrolledAddToBack(List, &Many[i]) : LL_UnrolledInsertAfterData(List, &Many[i / 2], &Many[i])), LL_OK);
+        }
+        uint32_t Seed = 7;
+        unsigned int Violations = 0;
+        for(unsigned int Removed = 0; Removed < 1000; Removed++)
+        {
+            unsigned int i;
+            do
+            {
+                Seed = Seed * 1103515245u + 12345u;
+                i = (Seed >> 16) % 1000;
+            } while(LL_UnrolledRemoveData(List, &Many[i]) != LL_OK);
+
+            Count = 0;
+            for(UnrolledBlock_t* Block = List->Head; Block; Block = Block->Next)
+            {
+                Violations += ((Block != List->Head) && (Block != List->Tail) && (Block->Count < LL_UNROLLED_BLOCK_SIZE / 2));
+                Violations += (Block->Count == 0) || ((uintptr_t)Block % 64 != 0);
+                Count += Block->Count;
+            }
+            Violations += (Count != 999 - Removed);
+        }
+        ExpectEqual(Violations, 0);
+        ExpectPtrNull(List->Head);
+        ExpectResponse(LL_UnrolledDeleteList(List), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 26: LL_NewInlineList Tests");
+    {
+        int Values[4] = {10, 20, 30, 40};
+
+        /* Test 1: Invalid arguments should return NULL */
+        ExpectPtrNull(LL_NewInlineList(LL_DOUBLE, 0));
+        ExpectPtrNull(LL_NewInlineList(5, sizeof(int)));
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: Values are copied into the nodes */
+            List_t* List = LL_NewInlineList(Linkage, sizeof(int));
+            ExpectEmptyList(List);
+            ExpectResponse(LL_AddToBack(List, &Values[1]), LL_OK);
+            ExpectResponse(LL_AddToFront(List, &Values[0]), LL_OK);
+            ExpectResponse(LL_AddToBack(List, &Values[3]), LL_OK);
+            ListNode_t* Head = LL_GetHead(List);
+            ExpectNotEqualPtr(LL_GetData(Head), &Values[0]);
+            ExpectEqual(*(int*)LL_GetData(Head), 10);
+            ExpectEqual(*(int*)LL_GetData(LL_GetTail(List)), 40);
+
+            /* Test 3: The value lives inside the node allocation */
+            ExpectEqual((char*)LL_GetData(Head) > (char*)Head, LL_TRUE);
+            ExpectEqual((char*)LL_GetData(Head) < (char*)Head + List->Pool.NodeSize, LL_TRUE);
+
+            /* Test 4: Data is looked up by value */
+            int Key = 20;
+            ListNode_t* Node = LL_GetNodeByData(List, &Key);
+            ExpectPtrNotNull(Node);
+            ExpectEqual(*(int*)LL_GetData(Node), 20);
+            ExpectResponse(LL_InsertAfterData(List, &Key, &Values[2]), LL_OK);
+            Key = 99;
+            ExpectPtrNull(LL_GetNodeByData(List, &Key));
+
+            /* Test 5: Set data copies the new value */
+            Key = 25;
+            ExpectResponse(LL_SetData(Node, &Key), LL_OK);
+            Key = 0;
+            ExpectEqual(*(int*)LL_GetData(Node), 25);
+
+            /* Test 6: Remove by value */
+            Key = 30;
+            ExpectResponse(LL_RemoveNodeByData(List, &Key), LL_OK);
+            ExpectResponse(LL_RemoveNodeByData(List, &Key), LL_NOT_OK);
+            ExpectResponse(LL_RemoveHead(List), LL_OK);
+            ExpectEqual(*(int*)LL_GetData(LL_GetHead(List)), 25);
+            ExpectEqual(*(int*)LL_GetData(LL_GetTail(List)), 40);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 27: LL_EnableHashIndex Tests");
+    {
+        TestData_t Items[300];
+
+        /* Test 1: NULL and inline lists can't have a hash index */
+        ExpectResponse(LL_EnableHashIndex(NULL), LL_NOT_OK);
+        List_t* List = LL_NewInlineList(LL_DOUBLE, sizeof(int));
+        ExpectResponse(LL_EnableHashIndex(List), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: The index is built from the nodes already in the list */
+            List = LL_NewList(Linkage);
+            for(unsigned int i = 0; i < 100; i++)
+            {
+                Items[i].Id = (int)i;
+                ExpectResponse(LL_AddToBack(List, &Items[i]), LL_OK);
+            }
+            ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+            ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+            ExpectPtrNotNull(List->HashIndex);
+            ExpectEqualPtr(LL_GetData(LL_GetNodeByData(List, &Items[42])), &Items[42]);
+
+            /* Test 3: The index is updated when adding nodes */
+            for(unsigned int i = 100; i < 300; i++)
+            {
+                Items[i].Id = (int)i;
+                ExpectResponse((i % 2 ? LL_AddToFront(List, &Items[i]) : LL_InsertAfterData(List, &Items[i - 100], &Items[i])), LL_OK);
+            }
+            for(unsigned int i = 0; i < 300; i++)
+            {
+                ExpectEqualPtr(LL_GetData(LL_GetNodeByData(List, &Items[i])), &Items[i]);
+            }
+            ExpectPtrNull(LL_GetNodeByData(List, &DummyData));
+            ExpectResponse(LL_RemoveNodeByData(List, &DummyData), LL_NOT_OK);
+
+            /* Test 4: The index is updated when removing nodes and setting data */
+            for(unsigned int i = 0; i < 300; i += 3)
+            {
+                ExpectResponse(LL_RemoveNodeByData(List, &Items[i]), LL_OK);
+                ExpectPtrNull(LL_GetNodeByData(List, &Items[i]));
+            }
+            ExpectResponse(LL_RemoveHead(List), LL_OK);
+            ExpectResponse(LL_RemoveTail(List), LL_OK);
+            ExpectResponse(LL_SetData(LL_GetNodeByData(List, &Items[1]), &TestData[0]), LL_OK);
+            ExpectPtrNull(LL_GetNodeByData(List, &Items[1]));
+            ExpectEqualPtr(LL_GetData(LL_GetNodeByData(List, &TestData[0])), &TestData[0]);
+            unsigned int NumFound = 0;
+            for(unsigned int i = 0; i < 300; i++)
+            {
+                NumFound += (LL_GetNodeByData(List, &Items[i]) ? 1 : 0);
+            }
+            unsigned int Count;
+            ExpectResponse(LL_GetCount(List, &Count), LL_OK);
+            ExpectEqual(NumFound, Count - 1);
+
+            /* Test 5: Data in several nodes: the first node is returned */
+            ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+            ExpectResponse(LL_AddToFront(List, &TestData[1]), LL_OK);
+            ExpectEqualPtr(LL_GetNodeByData(List, &TestData[1]), LL_GetHead(List));
+            ExpectResponse(LL_RemoveHead(List), LL_OK);
+            ExpectEqualPtr(LL_GetNodeByData(List, &TestData[1]), LL_GetTail(List));
+            ExpectResponse(LL_RemoveNodeByData(List, &TestData[1]), LL_OK);
+            ExpectPtrNull(LL_GetNodeByData(List, &TestData[1]));
+
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 28: LL_CursorRemove and LL_RemoveAfterNode Tests");
+    {
+        ListCursor_t Cursor;
+
+        /* Test 1: NULL and invalid arguments should fail */
+        ExpectResponse(LL_CursorRemove(NULL), LL_NOT_OK);
+        ExpectResponse(LL_RemoveAfterNode(NULL), LL_NOT_OK);
+        List_t* List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_CursorToHead(List, &Cursor), LL_NOT_OK);
+        ExpectPtrNull(LL_CursorGetNode(&Cursor));
+        ExpectResponse(LL_CursorRemove(&Cursor), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: Filter out every other node in one pass */
+            List = LL_NewList(Linkage);
+            for(unsigned int i = 0; i < 5; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[i]), LL_OK);
+            }
+            unsigned int Index = 0;
+            ListStatus_t Status = LL_CursorToHead(List, &Cursor);
+            while(Status == LL_OK)
+            {
+                Status = ((Index++ % 2 == 0) ? LL_CursorRemove(&Cursor) : LL_CursorNext(&Cursor));
+                Status = (LL_CursorGetNode(&Cursor) ? Status : LL_NOT_OK);
+            }
+            ExpectListWithIds(List, (int[]){102, 104}, 2);
+
+            /* Test 3: Removing the tail with a cursor leaves the cursor at NULL */
+            ExpectResponse(LL_AddToBack(List, &TestData[4]), LL_OK);
+            ExpectResponse(LL_CursorToHead(List, &Cursor), LL_OK);
+            ExpectResponse(LL_CursorNext(&Cursor), LL_OK);
+            ExpectResponse(LL_CursorNext(&Cursor), LL_OK);
+            ExpectResponse(LL_CursorRemove(&Cursor), LL_OK);
+            ExpectPtrNull(LL_CursorGetNode(&Cursor));
+            ExpectResponse(LL_CursorRemove(&Cursor), LL_NOT_OK);
+            ExpectListWithIds(List, (int[]){102, 104}, 2);
+
+            /* Test 4: Remove the node after a given node */
+            ExpectResponse(LL_AddToBack(List, &TestData[4]), LL_OK);
+            ExpectResponse(LL_RemoveAfterNode(LL_GetHead(List)), LL_OK);
+            ExpectListWithIds(List, (int[]){102, 105}, 2);
+            ExpectResponse(LL_RemoveAfterNode(LL_GetHead(List)), LL_OK);
+            ExpectListWithIds(List, (int[]){102}, 1);
+            ExpectResponse(LL_RemoveAfterNode(LL_GetTail(List)), LL_NOT_OK);
+
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 29: Position Index Tests");
+    {
+        static int Values[1000];
+        static int* Expected[1000];
+        unsigned int Count = 0;
+        unsigned int Index = 0;
+
+        /* Test 1: NULL and invalid arguments should fail */
+        ExpectPtrNull(LL_GetNodeAt(NULL, 0));
+        ExpectResponse(LL_GetNodeIndex(NULL, &Index), LL_NOT_OK);
+        ExpectResponse(LL_InsertAt(NULL, 0, &TestData[0]), LL_NOT_OK);
+        ExpectResponse(LL_RemoveAt(NULL, 0), LL_NOT_OK);
+        ExpectResponse(LL_EnablePositionIndex(NULL), LL_NOT_OK);
+        List_t* List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_EnablePositionIndex(List), LL_NOT_OK);
+        ExpectPtrNull(LL_GetNodeAt(List, 0));
+        ExpectResponse(LL_InsertAt(List, 1, &TestData[0]), LL_NOT_OK);
+        ExpectResponse(LL_RemoveAt(List, 0), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        /* Test 2: Positional functions work without the index, whatever the linkage */
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            List = LL_NewList(Linkage);
+            ExpectResponse(LL_InsertAt(List, 0, &TestData[1]), LL_OK);
+            ExpectResponse(LL_InsertAt(List, 0, &TestData[0]), LL_OK);
+            ExpectResponse(LL_InsertAt(List, 2, &TestData[4]), LL_OK);
+            ExpectResponse(LL_InsertAt(List, 2, &TestData[2]), LL_OK);
+            ExpectResponse(LL_InsertAt(List, 3, &TestData[3]), LL_OK);
+            ExpectListWithIds(List, (int[]){101, 102, 103, 104, 105}, 5);
+            ExpectEqualPtr(LL_GetData(LL_GetNodeAt(List, 3)), &TestData[3]);
+            ExpectPtrNull(LL_GetNodeAt(List, 5));
+            ExpectResponse(LL_GetNodeIndex(LL_GetTail(List), &Index), LL_OK);
+            ExpectEqual(Index, 4);
+            ExpectResponse(LL_RemoveAt(List, 2), LL_OK);
+            ExpectResponse(LL_RemoveAt(List, 3), LL_OK);
+            ExpectResponse(LL_RemoveAt(List, 0), LL_OK);
+            ExpectResponse(LL_RemoveAt(List, 2), LL_NOT_OK);
+            ExpectListWithIds(List, (int[]){102, 104}, 2);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 3: Enable the index on a list that already has nodes */
+        List = LL_NewList(LL_DOUBLE);
+        for(unsigned int i = 0; i < 1000; i++)
+        {
+            Values[i] = (int)i;
+        }
+        for(; Count < 300; Count++)
+        {
+            Expected[Count] = &Values[Count];
+            ExpectResponse(LL_AddToBack(List, Expected[Count]), LL_OK);
+        }
+        ExpectResponse(LL_EnablePositionIndex(List), LL_OK);
+        ExpectResponse(LL_EnablePositionIndex(List), LL_OK);
+
+        /* Test 4: Mix positional and regular adds and removals, checking against an array */
+        unsigned int Seed = 12345;
+        unsigned int Next = 300;
+        for(unsigned int Round = 0; Round < 3000; Round++)
+        {
+            Seed = Seed * 1103515245u + 12345u;
+            unsigned int Op = (Seed >> 16) % 6;
+            unsigned int Pos = (Count ? (Seed >> 8) % (Count + 1) : 0);
+
+            if((Op < 2) && (Count < 1000) && (Next < 1000))
+            {
+                ExpectResponse(LL_InsertAt(List, Pos, &Values[Next]), LL_OK);
+                memmove(&Expected[Pos + 1], &Expected[Pos], (Count - Pos) * sizeof(int*));
+                Expected[Pos] = &Values[Next++];
+                Count++;
+            }
+            else if((Op == 2) && (Next < 1000))
+            {
+                ExpectResponse(LL_AddToFront(List, &Values[Next]), LL_OK);
+                memmove(&Expected[1], &Expected[0], Count * sizeof(int*));
+                Expected[0] = &Values[Next++];
+                Count++;
+            }
+            else if((Op == 3) && Count)
+            {
+                Pos = Pos % Count;
+                ExpectResponse(LL_RemoveNode(LL_GetNodeAt(List, Pos)), LL_OK);
+                memmove(&Expected[Pos], &Expected[Pos + 1], (Count - Pos - 1) * sizeof(int*));
+                Count--;
+            }
+            else if(Count)
+            {
+                Pos = Pos % Count;
+                ExpectResponse(LL_RemoveAt(List, Pos), LL_OK);
+                memmove(&Expected[Pos], &Expected[Pos + 1], (Count - Pos - 1) * sizeof(int*));
+                Count--;
+            }
+
+            if(Next == 1000)
+            {
+                /* Recycle the values */
+                Next = 0;
+                for(unsigned int i = 0; i < Count; i++)
+                {
+                    Next = ((unsigned int)*Expected[i] >= Next ? (unsigned int)*Expected[i] + 1 : Next);
+                }
+            }
+        }
+
+        /* Test 5: Every node is found at its index and has the right index */
+        unsigned int Mismatches = 0;
+        unsigned int ListCount = 0;
+        ExpectResponse(LL_GetCount(List, &ListCount), LL_OK);
+        ExpectEqual(ListCount, Count);
+        ListNode_t* Node = LL_GetHead(List);
+        for(unsigned int i = 0; i < Count; i++, Node = LL_GetNext(Node))
+        {
+            Mismatches += (LL_GetNodeAt(List, i) != Node) || (LL_GetData(Node) != Expected[i]);
+            Mismatches += (LL_GetNodeIndex(Node, &Index) != LL_OK) || (Index != i);
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectPtrNull(LL_GetNodeAt(List, Count));
+
+        /* Test 6: Removing all nodes and adding them back keeps the index consistent */
+        while(LL_RemoveHead(List) == LL_OK);
+        ExpectEmptyList(List);
+        ExpectResponse(LL_InsertAt(List, 0, &TestData[2]), LL_OK);
+        ExpectResponse(LL_InsertAt(List, 0, &TestData[0]), LL_OK);
+        ExpectResponse(LL_InsertAt(List, 1, &TestData[1]), LL_OK);
+        ExpectListWithIds(List, (int[]){101, 102, 103}, 3);
+        ExpectResponse(LL_GetNodeIndex(LL_GetTail(List), &Index), LL_OK);
+        ExpectEqual(Index, 2);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 30: Sorted List Tests");
+    {
+        static int Values[2000];
+        int Key = 0;
+
+        /* Test 1: NULL and invalid arguments should fail */
+        ExpectPtrNull(LL_NewSortedList(LL_DOUBLE, NULL));
+        ExpectPtrNull(LL_NewSortedList((ListLinkage_t)7, CompareInts));
+        ExpectResponse(LL_Insert(NULL, &Key), LL_NOT_OK);
+        ExpectPtrNull(LL_Find(NULL, &Key));
+        ExpectPtrNull(LL_LowerBound(NULL, &Key));
+        List_t* List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_AddToBack(List, &Key), LL_OK);
+        ExpectResponse(LL_Insert(List, &Key), LL_NOT_OK);
+        ExpectPtrNull(LL_Find(List, &Key));
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            List = LL_NewSortedList(Linkage, CompareInts);
+            ExpectPtrNotNull(List);
+            ExpectResponse(LL_Insert(List, NULL), LL_NOT_OK);
+            ExpectPtrNull(LL_LowerBound(List, &Key));
+
+            /* Test 2: Data inserted in random order comes out sorted, equivalent data in insertion order */
+            unsigned int Seed = 2024 + Linkage;
+            for(unsigned int i = 0; i < 2000; i++)
+            {
+                Seed = Seed * 1103515245u + 12345u;
+                Values[i] = (int)((Seed >> 16) % 500) * 2;
+                ExpectResponse(LL_Insert(List, &Values[i]), LL_OK);
+            }
+            unsigned int Unordered = 0;
+            ListCursor_t Cursor;
+            ListStatus_t Status = LL_CursorToHead(List, &Cursor);
+            int* Last = LL_GetData(LL_CursorGetNode(&Cursor));
+            while((Status = LL_CursorNext(&Cursor)) == LL_OK)
+            {
+                int* Current = LL_GetData(LL_CursorGetNode(&Cursor));
+                Unordered += (*Current < *Last) || ((*Current == *Last) && (Current < Last));
+                Last = Current;
+            }
+            ExpectEqual(Unordered, 0);
+
+            /* Test 3: Look up by key, not by pointer */
+            unsigned int Misses = 0;
+            for(Key = -1; Key <= 1000; Key++)
+            {
+                ListNode_t* Node = LL_LowerBound(List, &Key);
+                ListNode_t* Found = LL_Find(List, &Key);
+                Misses += (Node && (*(int*)LL_GetData(Node) < Key));
+                Misses += (Found && ((Found != Node) || (*(int*)LL_GetData(Found) != Key)));
+                Misses += ((Key % 2 != 0) && Found);
+            }
+            ExpectEqual(Misses, 0);
+            Key = 1000;
+            ExpectPtrNull(LL_LowerBound(List, &Key));
+            Key = -5;
+            ExpectEqualPtr(LL_LowerBound(List, &Key), LL_GetHead(List));
+
+            /* Test 4: Functions that would break the order fail */
+            ExpectResponse(LL_AddToFront(List, &Key), LL_NOT_OK);
+            ExpectResponse(LL_AddToBack(List, &Key), LL_NOT_OK);
+            ExpectResponse(LL_InsertAfterNode(LL_GetHead(List), &Key), LL_NOT_OK);
+            ExpectResponse(LL_InsertAfterData(List, LL_GetData(LL_GetHead(List)), &Key), LL_NOT_OK);
+            ExpectResponse(LL_InsertAt(List, 0, &Key), LL_NOT_OK);
+            ExpectResponse(LL_SetData(LL_GetHead(List), &Key), LL_NOT_OK);
+
+            /* Test 5: Removals keep the lookups working */
+            unsigned int Count = 0;
+            Key = 0;
+            while(LL_Find(List, &Key))
+            {
+                ExpectResponse(LL_RemoveNode(LL_Find(List, &Key)), LL_OK);
+            }
+            ExpectPtrNull(LL_Find(List, &Key));
+            Key = 2;
+            ListNode_t* Node = LL_Find(List, &Key);
+            ExpectEqualPtr(LL_GetHead(List), Node);
+            ExpectResponse(LL_GetCount(List, &Count), LL_OK);
+            ExpectEqual(Count < 2000, LL_TRUE);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 31: LL_ForEach Tests");
+    {
+        int Ids[2 + 100];
+
+        /* Test 1: NULL and invalid arguments should fail */
+        ExpectResponse(LL_ForEach(NULL, CollectIds, Ids), LL_NOT_OK);
+        ExpectResponse(LL_ForEachReverse(NULL, CollectIds, Ids), LL_NOT_OK);
+        List_t* List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_ForEach(List, NULL, Ids), LL_NOT_OK);
+        ExpectResponse(LL_ForEachReverse(List, CollectIds, Ids), LL_NOT_OK);
+
+        /* Test 2: An empty list is not visited */
+        Ids[0] = 0;
+        Ids[1] = 100;
+        ExpectResponse(LL_ForEach(List, CollectIds, Ids), LL_OK);
+        ExpectEqual(Ids[0], 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 3: All nodes are visited in order, in lists longer and shorter than the prefetch distance */
+            List = LL_NewList(Linkage);
+            for(unsigned int i = 0; i < 100; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[i % 5]), LL_OK);
+            }
+            Ids[0] = 0;
+            Ids[1] = 100;
+            ExpectResponse(LL_ForEach(List, CollectIds, Ids), LL_OK);
+            ExpectEqual(Ids[0], 100);
+            unsigned int Mismatches = 0;
+            for(unsigned int i = 0; i < 100; i++)
+            {
+                Mismatches += (Ids[2 + i] != 101 + (int)(i % 5));
+            }
+            ExpectEqual(Mismatches, 0);
+
+            /* Test 4: The visit stops when the function returns LL_FALSE */
+            Ids[0] = 0;
+            Ids[1] = 7;
+            ExpectResponse(LL_ForEach(List, CollectIds, Ids), LL_OK);
+            ExpectEqual(Ids[0], 7);
+
+            /* Test 5: Reverse visits go from tail to head */
+            while(LL_GetNodeAt(List, 3))
+            {
+                ExpectResponse(LL_RemoveTail(List), LL_OK);
+            }
+            ExpectListWithIds(List, (int[]){101, 102, 103}, 3);
+            Ids[0] = 0;
+            Ids[1] = 100;
+            if(Linkage != LL_SINGLE)
+            {
+                ExpectResponse(LL_ForEachReverse(List, CollectIds, Ids), LL_OK);
+                ExpectEqual(Ids[0], 3);
+                ExpectEqual(Ids[2], 103);
+                ExpectEqual(Ids[4], 101);
+            }
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+
+            /* Test 6: Nodes consecutive in memory or not are visited the same way */
+            for(unsigned int Contiguous = 0; Contiguous < 2; Contiguous++)
+            {
+                void* Data[20];
+                for(unsigned int i = 0; i < 20; i++)
+                {
+                    Data[i] = &TestData[i % 5];
+                }
+                List = (Contiguous ? LL_FromArray(Linkage, Data, 20) : LL_NewList(Linkage));
+                for(unsigned int i = 0; !Contiguous && (i < 20); i++)
+                {
+                    ExpectResponse(LL_AddToFront(List, Data[19 - i]), LL_OK);
+                }
+                ExpectEqual(List->Contiguous, (ListBool_t)Contiguous);
+                Ids[0] = 0;
+                Ids[1] = 100;
+                ExpectResponse((Linkage == LL_SINGLE ? LL_ForEach(List, CollectIds, Ids) : LL_ForEachReverse(List, CollectIds, Ids)), LL_OK);
+                Mismatches = (Ids[0] != 20);
+                for(unsigned int i = 0; i < 20; i++)
+                {
+                    Mismatches += (Ids[2 + i] != (Linkage == LL_SINGLE ? 101 + (int)(i % 5) : 105 - (int)(i % 5)));
+                }
+                ExpectEqual(Mismatches, 0);
+                ExpectResponse(LL_DeleteList(List), LL_OK);
+            }
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 32: LL_FindAll and LL_CountMatches Tests");
+    {
+        ListNode_t* Nodes[100];
+        unsigned int NumNodes = 0;
+        unsigned int Count = 0;
+
+        /* Test 1: NULL arguments should fail */
+        List_t* List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_FindAll(NULL, &TestData[0], Nodes, 100, &NumNodes), LL_NOT_OK);
+        ExpectResponse(LL_FindAll(List, NULL, Nodes, 100, &NumNodes), LL_NOT_OK);
+        ExpectResponse(LL_FindAll(List, &TestData[0], NULL, 100, &NumNodes), LL_NOT_OK);
+        ExpectResponse(LL_FindAll(List, &TestData[0], Nodes, 100, NULL), LL_NOT_OK);
+        ExpectResponse(LL_CountMatches(NULL, &TestData[0], &Count), LL_NOT_OK);
+        ExpectResponse(LL_CountMatches(List, NULL, &Count), LL_NOT_OK);
+        ExpectResponse(LL_CountMatches(List, &TestData[0], NULL), LL_NOT_OK);
+
+        /* Test 2: Nothing is found in an empty list */
+        ExpectResponse(LL_FindAll(List, &TestData[0], Nodes, 100, &NumNodes), LL_OK);
+        ExpectEqual(NumNodes, 0);
+        ExpectResponse(LL_CountMatches(List, &TestData[0], &Count), LL_OK);
+        ExpectEqual(Count, 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 3: Duplicates spread over several batches are all found, in order */
+            List = LL_NewList(Linkage);
+            for(unsigned int i = 0; i < 99; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[(i % 7 == 3) ? 2 : i % 2]), LL_OK);
+            }
+            ExpectResponse(LL_FindAll(List, &TestData[2], Nodes, 100, &NumNodes), LL_OK);
+            ExpectEqual(NumNodes, 14);
+            unsigned int Mismatches = 0;
+            for(unsigned int i = 0; i < NumNodes; i++)
+            {
+                unsigned int Index = 0;
+                Mismatches += (LL_GetNodeIndex(Nodes[i], &Index) != LL_OK) || (Index != 7 * i + 3);
+            }
+            ExpectEqual(Mismatches, 0);
+            ExpectResponse(LL_CountMatches(List, &TestData[2], &Count), LL_OK);
+            ExpectEqual(Count, 14);
+            ExpectResponse(LL_CountMatches(List, &TestData[4], &Count), LL_OK);
+            ExpectEqual(Count, 0);
+
+            /* Test 4: At most MaxNodes nodes are stored */
+            ExpectResponse(LL_FindAll(List, &TestData[2], Nodes, 5, &NumNodes), LL_OK);
+            ExpectEqual(NumNodes, 5);
+            ExpectResponse(LL_FindAll(List, &TestData[2], Nodes, 0, &NumNodes), LL_OK);
+            ExpectEqual(NumNodes, 0);
+
+            /* Test 5: Lookups by data find the first node, removals keep the list consistent */
+            ExpectEqualPtr(LL_GetNodeByData(List, &TestData[2]), LL_GetNodeAt(List, 3));
+            ExpectResponse(LL_RemoveNodeByData(List, &TestData[2]), LL_OK);
+            ExpectEqualPtr(LL_GetNodeByData(List, &TestData[2]), LL_GetNodeAt(List, 9));
+            ExpectResponse(LL_CountMatches(List, &TestData[2], &Count), LL_OK);
+            ExpectEqual(Count, 13);
+
+            /* Test 6: The hash index gives the same count */
+            ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+            ExpectResponse(LL_CountMatches(List, &TestData[2], &Count), LL_OK);
+            ExpectEqual(Count, 13);
+            ExpectResponse(LL_CountMatches(List, &TestData[4], &Count), LL_OK);
+            ExpectEqual(Count, 0);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 7: Inline lists compare values */
+        List = LL_NewInlineList(LL_DOUBLE, sizeof(int));
+        for(int i = 0; i < 50; i++)
+        {
+            int Value = i % 10;
+            ExpectResponse(LL_AddToBack(List, &Value), LL_OK);
+        }
+        int Value = 7;
+        ExpectResponse(LL_FindAll(List, &Value, Nodes, 100, &NumNodes), LL_OK);
+        ExpectEqual(NumNodes, 5);
+        ExpectEqual(*(int*)LL_GetData(Nodes[4]), 7);
+        ExpectResponse(LL_CountMatches(List, &Value, &Count), LL_OK);
+        ExpectEqual(Count, 5);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 33: Lookup Policy Tests");
+    {
+        ListLookupStats_t Stats;
+        TestData_t Missing = {.Id = 999};
+
+        /* Test 1: NULL and invalid arguments should fail */
+        ExpectResponse(LL_SetLookupPolicy(NULL, LL_LOOKUP_PLAIN), LL_NOT_OK);
+        ExpectResponse(LL_GetLookupStats(NULL, &Stats), LL_NOT_OK);
+        ExpectResponse(LL_ResetLookupStats(NULL), LL_NOT_OK);
+        List_t* List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_SetLookupPolicy(List, (ListLookupPolicy_t)3), LL_NOT_OK);
+        ExpectResponse(LL_GetLookupStats(List, NULL), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        List = LL_NewSortedList(LL_SINGLE, CompareInts);
+        ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_MOVE_TO_FRONT), LL_NOT_OK);
+        ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_PLAIN), LL_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            List = LL_NewList(Linkage);
+            for(unsigned int i = 0; i < 5; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[i]), LL_OK);
+            }
+
+            /* Test 2: Plain lookups count probes and don't reorder */
+            ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[3]));
+            ExpectPtrNull(LL_GetNodeByData(List, &Missing));
+            ExpectResponse(LL_GetLookupStats(List, &Stats), LL_OK);
+            ExpectEqual((unsigned int)Stats.NumLookups, 2);
+            ExpectEqual((unsigned int)Stats.NumFound, 1);
+            ExpectEqual((unsigned int)Stats.NumProbes, 4 + 5);
+            ExpectListWithIds(List, (int[]){101, 102, 103, 104, 105}, 5);
+            ExpectResponse(LL_ResetLookupStats(List), LL_OK);
+            ExpectResponse(LL_GetLookupStats(List, &Stats), LL_OK);
+            ExpectEqual((unsigned int)Stats.NumLookups, 0);
+
+            /* Test 3: Transpose swaps the found node with its prev node */
+            ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_TRANSPOSE), LL_OK);
+            ListNode_t* Node = LL_GetNodeByData(List, &TestData[3]);
+            ExpectEqualPtr(LL_GetData(Node), &TestData[3]);
+            ExpectListWithIds(List, (int[]){101, 102, 104, 103, 105}, 5);
+            ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[1]));
+            ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[1]));
+            ExpectListWithIds(List, (int[]){102, 101, 104, 103, 105}, 5);
+
+            /* Test 4: Move-to-front brings the found node to the head */
+            ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_MOVE_TO_FRONT), LL_OK);
+            ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[4]));
+            ExpectListWithIds(List, (int[]){105, 102, 101, 104, 103}, 5);
+            ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[3]));
+            ExpectListWithIds(List, (int[]){104, 105, 102, 101, 103}, 5);
+
+            /* Test 5: Skewed lookups get cheaper with move-to-front, also with the hash index */
+            ExpectResponse(LL_ResetLookupStats(List), LL_OK);
+            for(unsigned int i = 0; i < 10; i++)
+            {
+                ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[2]));
+            }
+            ExpectResponse(LL_GetLookupStats(List, &Stats), LL_OK);
+            ExpectEqual((unsigned int)Stats.NumProbes, 5 + 9);
+            if(Linkage != LL_DOUBLE)
+            {
+                /* Reordering the nodes found by the hash index would walk the list */
+                ExpectResponse(LL_EnableHashIndex(List), LL_NOT_OK);
+                ExpectResponse(LL_DeleteList(List), LL_OK);
+                continue;
+            }
+            ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+            ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[2]));
+            ExpectPtrNotNull(LL_GetNodeByData(List, &TestData[0]));
+            ExpectListWithIds(List, (int[]){101, 103, 104, 105, 102}, 5);
+            ExpectResponse(LL_RemoveNodeByData(List, &TestData[1]), LL_OK);
+            ExpectEqualPtr(LL_GetNodeByData(List, &TestData[1]), NULL);
+            Node = LL_GetNodeByData(List, &TestData[4]);
+            ExpectEqualPtr(Node, LL_GetHead(List));
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 6: Reordering keeps the position index consistent */
+        List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_EnablePositionIndex(List), LL_OK);
+        ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_MOVE_TO_FRONT), LL_OK);
+        static int Values[200];
+        for(unsigned int i = 0; i < 200; i++)
+        {
+            ExpectResponse(LL_AddToBack(List, &Values[i]), LL_OK);
+        }
+        for(unsigned int i = 0; i < 200; i += 3)
+        {
+            ExpectPtrNotNull(LL_GetNodeByData(List, &Values[(i * 7) % 200]));
+        }
+        ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_TRANSPOSE), LL_OK);
+        for(unsigned int i = 0; i < 200; i += 3)
+        {
+            ExpectPtrNotNull(LL_GetNodeByData(List, &Values[(i * 11) % 200]));
+        }
+        unsigned int Mismatches = 0;
+        unsigned int Index = 0;
+        ListNode_t* Node = LL_GetHead(List);
+        for(unsigned int i = 0; i < 200; i++, Node = LL_GetNext(Node))
+        {
+            Mismatches += (LL_GetNodeAt(List, i) != Node) || (LL_GetNodeIndex(Node, &Index) != LL_OK) || (Index != i);
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        /* Test 7: Singly and XOR linked lists with a hash index only do plain lookups */
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage += 2)
+        {
+            List = LL_NewList(Linkage);
+            ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+            ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_MOVE_TO_FRONT), LL_NOT_OK);
+            ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_TRANSPOSE), LL_NOT_OK);
+            ExpectResponse(LL_SetLookupPolicy(List, LL_LOOKUP_PLAIN), LL_OK);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 34: LL_EnableBloomFilter Tests");
+    {
+        static TestData_t Items[2000];
+        ListLookupStats_t Stats;
+        unsigned int Count = 0;
+
+        /* Test 1: NULL and inline lists should fail */
+        ExpectResponse(LL_EnableBloomFilter(NULL), LL_NOT_OK);
+        List_t* List = LL_NewInlineList(LL_SINGLE, sizeof(int));
+        ExpectResponse(LL_EnableBloomFilter(List), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: Enable the filter on a list that already has nodes, then let it grow */
+            List = LL_NewList(Linkage);
+            for(unsigned int i = 0; i < 5; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[i]), LL_OK);
+            }
+            ExpectResponse(LL_EnableBloomFilter(List), LL_OK);
+            ExpectResponse(LL_EnableBloomFilter(List), LL_OK);
+            for(unsigned int i = 0; i < 1000; i++)
+            {
+                Items[i].Id = (int)i;
+                ExpectResponse(LL_AddToFront(List, &Items[i]), LL_OK);
+            }
+
+            /* Test 3: Data in the list is always found */
+            unsigned int Misses = 0;
+            for(unsigned int i = 0; i < 1000; i++)
+            {
+                Misses += (LL_GetNodeByData(List, &Items[i]) == NULL);
+            }
+            Misses += (LL_GetNodeByData(List, &TestData[4]) != LL_GetTail(List));
+            ExpectEqual(Misses, 0);
+
+            /* Test 4: Most lookups of data not in the list don't visit any node */
+            ExpectResponse(LL_ResetLookupStats(List), LL_OK);
+            for(unsigned int i = 1000; i < 2000; i++)
+            {
+                ExpectPtrNull(LL_GetNodeByData(List, &Items[i]));
+            }
+            ExpectResponse(LL_RemoveNodeByData(List, &Items[1500]), LL_NOT_OK);
+            ExpectResponse(LL_CountMatches(List, &Items[1500], &Count), LL_OK);
+            ExpectEqual(Count, 0);
+            ExpectResponse(LL_GetLookupStats(List, &Stats), LL_OK);
+            ExpectEqual((unsigned int)Stats.NumLookups, 1001);
+            ExpectEqual((unsigned int)Stats.NumFound, 0);
+            ExpectEqual(Stats.NumProbes < 100 * 1005, LL_TRUE);
+
+            /* Test 5: Removed and replaced data is not found anymore */
+            for(unsigned int i = 0; i < 1000; i += 2)
+            {
+                ExpectResponse(LL_RemoveNodeByData(List, &Items[i]), LL_OK);
+            }
+            ExpectResponse(LL_SetData(LL_GetHead(List), &Items[1999]), LL_OK);
+            ExpectPtrNull(LL_GetNodeByData(List, &Items[999]));
+            ExpectEqualPtr(LL_GetNodeByData(List, &Items[1999]), LL_GetHead(List));
+            ExpectResponse(LL_ResetLookupStats(List), LL_OK);
+            for(unsigned int i = 0; i < 1000; i += 2)
+            {
+                ExpectPtrNull(LL_GetNodeByData(List, &Items[i]));
+            }
+            ExpectResponse(LL_GetLookupStats(List, &Stats), LL_OK);
+            ExpectEqual(Stats.NumProbes < 50 * 505, LL_TRUE);
+            ExpectResponse(LL_GetCount(List, &Count), LL_OK);
+            ExpectEqual(Count, 505);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 35: LL_AddArrayToFront and LL_AddArrayToBack Tests");
+    {
+        static TestData_t Items[70000];
+        static void* Pointers[70000];
+        void* Some[] = {&TestData[1], &TestData[2], NULL};
+
+        /* Test 1: NULL arguments, NULL data and sorted lists should fail and leave the list unchanged */
+        List_t* List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_AddArrayToBack(NULL, Some, 2), LL_NOT_OK);
+        ExpectResponse(LL_AddArrayToFront(List, NULL, 2), LL_NOT_OK);
+        ExpectResponse(LL_AddArrayToBack(List, Some, 3), LL_NOT_OK);
+        ExpectResponse(LL_AddArrayToFront(List, Some, 3), LL_NOT_OK);
+        ExpectEmptyList(List);
+        ExpectResponse(LL_AddArrayToBack(List, Some, 0), LL_OK);
+        ExpectEmptyList(List);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        List = LL_NewSortedList(LL_SINGLE, CompareInts);
+        ExpectResponse(LL_AddArrayToBack(List, Some, 2), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: Arrays are added in order, to an empty list and around existing nodes */
+            List = LL_NewList(Linkage);
+            ExpectResponse(LL_AddArrayToBack(List, Some, 2), LL_OK);
+            ExpectListWithIds(List, (int[]){102, 103}, 2);
+            ExpectResponse(LL_AddArrayToFront(List, (void*[]){&TestData[0]}, 1), LL_OK);
+            ExpectResponse(LL_AddArrayToBack(List, (void*[]){&TestData[3], &TestData[4]}, 2), LL_OK);
+            ExpectListWithIds(List, (int[]){101, 102, 103, 104, 105}, 5);
+            ExpectResponse(LL_AddArrayToFront(List, (void*[]){&TestData[4], &TestData[3]}, 2), LL_OK);
+            ExpectListWithIds(List, (int[]){105, 104, 101, 102, 103, 104, 105}, 7);
+
+            /* Test 3: Nodes added in batches can be removed and reused */
+            ExpectResponse(LL_RemoveNodeByData(List, &TestData[0]), LL_OK);
+            ExpectResponse(LL_RemoveHead(List), LL_OK);
+            ExpectResponse(LL_RemoveTail(List), LL_OK);
+            ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+            ExpectListWithIds(List, (int[]){104, 102, 103, 104, 101}, 5);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 4: A big batch takes a single allocation, then batches keep the indexes consistent */
+        TestAllocator_t Allocator = {0, 0};
+        List = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        for(unsigned int i = 0; i < 70000; i++)
+        {
+            Items[i].Id = (int)i;
+            Pointers[i] = &Items[i];
+        }
+        ExpectResponse(LL_AddArrayToBack(List, Pointers, 10), LL_OK);
+        unsigned int NumAllocs = Allocator.NumAllocs;
+        ExpectResponse(LL_AddArrayToBack(List, &Pointers[10], 65536), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, NumAllocs + 1);
+        ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+        ExpectResponse(LL_EnableBloomFilter(List), LL_OK);
+        ExpectResponse(LL_AddArrayToFront(List, &Pointers[65546], 4000), LL_OK);
+        ExpectResponse(LL_AddArrayToBack(List, &Pointers[69546], 454), LL_OK);
+        unsigned int Count = 0;
+        ExpectResponse(LL_GetCount(List, &Count), LL_OK);
+        ExpectEqual(Count, 70000);
+        unsigned int Mismatches = 0;
+        unsigned int Index = 0;
+        for(unsigned int i = 0; i < 70000; i += 7)
+        {
+            unsigned int Expected = (i < 4000 ? 65546 + i : (i < 69546 ? i - 4000 : i));
+            ListNode_t* Node = LL_GetNodeAt(List, i);
+            Mismatches += (LL_GetData(Node) != &Items[Expected]);
+            Mismatches += (LL_GetNodeByData(List, &Items[Expected]) != Node);
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+
+        /* Test 5: Batches keep the position index consistent */
+        List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_EnablePositionIndex(List), LL_OK);
+        ExpectResponse(LL_AddArrayToBack(List, Pointers, 500), LL_OK);
+        ExpectResponse(LL_AddArrayToFront(List, &Pointers[500], 300), LL_OK);
+        ExpectResponse(LL_AddArrayToBack(List, &Pointers[800], 200), LL_OK);
+        for(unsigned int i = 0; i < 1000; i++)
+        {
+            unsigned int Expected = (i < 300 ? 500 + i : (i < 800 ? i - 300 : i));
+            ListNode_t* Node = LL_GetNodeAt(List, i);
+            Mismatches += (LL_GetData(Node) != &Items[Expected]);
+            Mismatches += (LL_GetNodeIndex(Node, &Index) != LL_OK) || (Index != i);
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        /* Test 6: Inline lists copy the values */
+        List = LL_NewInlineList(LL_XOR, sizeof(int));
+        int Values[] = {7, 8, 9};
+        ExpectResponse(LL_AddArrayToBack(List, (void*[]){&Values[0], &Values[1], &Values[2]}, 3), LL_OK);
+        Values[1] = 0;
+        ExpectEqual(*(int*)LL_GetData(LL_GetNodeAt(List, 1)), 8);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 36: LL_Concat and LL_Splice Tests");
+    {
+        static TestData_t Items[300];
+        static void* Pointers[300];
+        void* All[] = {&TestData[0], &TestData[1], &TestData[2], &TestData[3], &TestData[4]};
+
+        /* Test 1: Invalid arguments and lists that can't exchange nodes should fail */
+        List_t* A = LL_NewList(LL_DOUBLE);
+        List_t* B = LL_NewList(LL_SINGLE);
+        List_t* Sorted = LL_NewSortedList(LL_DOUBLE, CompareInts);
+        TestAllocator_t Allocator = {0, 0};
+        List_t* Other = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        ExpectResponse(LL_AddArrayToBack(A, All, 5), LL_OK);
+        ExpectResponse(LL_Concat(NULL, A), LL_NOT_OK);
+        ExpectResponse(LL_Concat(A, NULL), LL_NOT_OK);
+        ExpectResponse(LL_Concat(A, A), LL_NOT_OK);
+        ExpectResponse(LL_Concat(B, A), LL_NOT_OK);
+        ExpectResponse(LL_Concat(Sorted, A), LL_NOT_OK);
+        ExpectResponse(LL_Concat(Other, A), LL_NOT_OK);
+        ListNode_t* Second = LL_GetNodeAt(A, 1);
+        ListNode_t* Fourth = LL_GetNodeAt(A, 3);
+        ExpectResponse(LL_Splice(NULL, NULL, Second, Fourth), LL_NOT_OK);
+        ExpectResponse(LL_Splice(B, NULL, Second, Fourth), LL_NOT_OK);
+        ExpectResponse(LL_Splice(Sorted, NULL, Second, Fourth), LL_NOT_OK);
+        ExpectResponse(LL_Splice(A, NULL, Fourth, Second), LL_NOT_OK);
+        ExpectResponse(LL_Splice(A, LL_GetNodeAt(A, 2), Second, Fourth), LL_NOT_OK);
+        ExpectResponse(LL_Splice(A, Fourth, Second, Fourth), LL_NOT_OK);
+        ExpectListWithIds(A, (int[]){101, 102, 103, 104, 105}, 5);
+        ExpectResponse(LL_DeleteList(A), LL_OK);
+        ExpectResponse(LL_DeleteList(B), LL_OK);
+        ExpectResponse(LL_DeleteList(Sorted), LL_OK);
+        ExpectResponse(LL_DeleteList(Other), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: Concatenated nodes belong to the destination, also after several concatenations */
+            A = LL_NewList(Linkage);
+            B = LL_NewList(Linkage);
+            List_t* C = LL_NewList(Linkage);
+            ExpectResponse(LL_AddArrayToBack(A, All, 2), LL_OK);
+            ExpectResponse(LL_AddArrayToBack(B, &All[2], 3), LL_OK);
+            ListNode_t* Moved = LL_GetTail(B);
+            ExpectResponse(LL_Concat(A, B), LL_OK);
+            ExpectListWithIds(A, (int[]){101, 102, 103, 104, 105}, 5);
+            ExpectResponse(LL_AddToBack(C, &TestData[0]), LL_OK);
+            ExpectResponse(LL_Concat(C, A), LL_OK);
+            ExpectListWithIds(C, (int[]){101, 101, 102, 103, 104, 105}, 6);
+            ExpectResponse(LL_RemoveNode(Moved), LL_OK);
+            ExpectResponse(LL_InsertAfterNode(LL_GetNodeAt(C, 3), &TestData[4]), LL_OK);
+            ExpectListWithIds(C, (int[]){101, 101, 102, 103, 105, 104}, 6);
+            B = LL_NewList(Linkage);
+            ExpectResponse(LL_Concat(C, B), LL_OK);
+            ExpectEqual(C->Count, 6);
+            ExpectResponse(LL_DeleteList(C), LL_OK);
+
+            /* Test 3: A range moves to another list, which can outlive the list it came from */
+            A = LL_NewList(Linkage);
+            B = LL_NewList(Linkage);
+            ExpectResponse(LL_AddArrayToBack(A, All, 5), LL_OK);
+            ExpectResponse(LL_AddToBack(B, &TestData[0]), LL_OK);
+            ExpectResponse(LL_Splice(B, LL_GetHead(B), LL_GetNodeAt(A, 1), LL_GetNodeAt(A, 3)), LL_OK);
+            ExpectListWithIds(A, (int[]){101, 105}, 2);
+            ExpectListWithIds(B, (int[]){101, 102, 103, 104}, 4);
+            ExpectResponse(LL_Splice(B, NULL, LL_GetTail(A), LL_GetTail(A)), LL_OK);
+            ExpectListWithIds(A, (int[]){101}, 1);
+            ExpectListWithIds(B, (int[]){105, 101, 102, 103, 104}, 5);
+            ExpectResponse(LL_RemoveNode(LL_GetNodeAt(B, 2)), LL_OK);
+            ExpectResponse(LL_DeleteList(A), LL_OK);
+            ExpectResponse(LL_AddToBack(B, &TestData[1]), LL_OK);
+            ExpectListWithIds(B, (int[]){105, 101, 103, 104, 102}, 5);
+
+            /* Test 4: A range moves within its list */
+            ExpectResponse(LL_Splice(B, LL_GetTail(B), LL_GetHead(B), LL_GetNodeAt(B, 1)), LL_OK);
+            ExpectListWithIds(B, (int[]){103, 104, 102, 105, 101}, 5);
+            ExpectResponse(LL_Splice(B, NULL, LL_GetNodeAt(B, 2), LL_GetTail(B)), LL_OK);
+            ExpectListWithIds(B, (int[]){102, 105, 101, 103, 104}, 5);
+            ExpectResponse(LL_Splice(B, LL_GetNodeAt(B, 3), LL_GetNodeAt(B, 1), LL_GetNodeAt(B, 2)), LL_OK);
+            ExpectListWithIds(B, (int[]){102, 103, 105, 101, 104}, 5);
+            ExpectResponse(LL_DeleteList(B), LL_OK);
+        }
+
+        /* Test 5: Moved nodes keep the indexes of both lists consistent */
+        for(unsigned int i = 0; i < 300; i++)
+        {
+            Items[i].Id = (int)i;
+            Pointers[i] = &Items[i];
+        }
+        A = LL_NewList(LL_DOUBLE);
+        B = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_AddArrayToBack(A, Pointers, 200), LL_OK);
+        ExpectResponse(LL_AddArrayToBack(B, &Pointers[200], 100), LL_OK);
+        ExpectResponse(LL_EnablePositionIndex(A), LL_OK);
+        ExpectResponse(LL_EnableHashIndex(A), LL_OK);
+        ExpectResponse(LL_EnablePositionIndex(B), LL_OK);
+        ExpectResponse(LL_EnableBloomFilter(B), LL_OK);
+        ExpectResponse(LL_Splice(B, LL_GetNodeAt(B, 9), LL_GetNodeAt(A, 50), LL_GetNodeAt(A, 149)), LL_OK);
+        ExpectEqual(A->Count, 100);
+        ExpectEqual(B->Count, 200);
+        unsigned int Mismatches = 0;
+        unsigned int Index = 0;
+        for(unsigned int i = 0; i < 200; i++)
+        {
+            unsigned int ExpectedA = (i < 50 ? i : i + 100);
+            unsigned int ExpectedB = (i < 10 ? 200 + i : (i < 110 ? i + 40 : i + 100));
+            ListNode_t* Node = LL_GetNodeAt(B, i);
+            Mismatches += (LL_GetData(Node) != &Items[ExpectedB]);
+            Mismatches += (LL_GetNodeIndex(Node, &Index) != LL_OK) || (Index != i);
+            Mismatches += (LL_GetNodeByData(B, &Items[ExpectedB]) != Node);
+            if(i < 100)
+            {
+                Node = LL_GetNodeAt(A, i);
+                Mismatches += (LL_GetData(Node) != &Items[ExpectedA]);
+                Mismatches += (LL_GetNodeIndex(Node, &Index) != LL_OK) || (Index != i);
+                Mismatches += (LL_GetNodeByData(A, &Items[ExpectedA]) != Node);
+                Mismatches += (LL_GetNodeByData(A, &Items[50 + i]) != NULL);
+            }
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectResponse(LL_Concat(B, A), LL_OK);
+        ExpectEqual(B->Count, 300);
+        for(unsigned int i = 0; i < 300; i += 3)
+        {
+            ListNode_t* Node = LL_GetNodeAt(B, i);
+            Mismatches += (LL_GetNodeIndex(Node, &Index) != LL_OK) || (Index != i);
+            Mismatches += (LL_GetNodeByData(B, LL_GetData(Node)) != Node);
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectResponse(LL_DeleteList(B), LL_OK);
+
+        /* Test 6: Concatenation doesn't allocate memory, and all the memory is released at the end */
+        A = LL_NewListWithAllocator(LL_XOR, TestAlloc, TestFree, &Allocator);
+        B = LL_NewListWithAllocator(LL_XOR, TestAlloc, TestFree, &Allocator);
+        List_t* C = LL_NewListWithAllocator(LL_XOR, TestAlloc, TestFree, &Allocator);
+        ExpectResponse(LL_AddArrayToBack(A, Pointers, 100), LL_OK);
+        ExpectResponse(LL_AddArrayToBack(B, &Pointers[100], 100), LL_OK);
+        ExpectResponse(LL_Splice(C, NULL, LL_GetHead(A), LL_GetNodeAt(A, 9)), LL_OK);
+        unsigned int NumAllocs = Allocator.NumAllocs;
+        ExpectResponse(LL_Concat(A, B), LL_OK);
+        ExpectResponse(LL_Concat(C, A), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, NumAllocs);
+        ExpectEqual(C->Count, 200);
+        ExpectEqualPtr(LL_GetData(LL_GetHead(C)), &Items[0]);
+        ExpectEqualPtr(LL_GetData(LL_GetTail(C)), &Items[199]);
+        ExpectResponse(LL_DeleteList(C), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 37: LL_SplitAfter and LL_SplitInto Tests");
+    {
+        static TestData_t Items[1000];
+        static void* Pointers[1000];
+        void* All[] = {&TestData[0], &TestData[1], &TestData[2], &TestData[3], &TestData[4]};
+        List_t* Parts[4];
+        List_t* NewList = NULL;
+
+        /* Test 1: NULL arguments should fail */
+        List_t* List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_SplitAfter(NULL, &NewList), LL_NOT_OK);
+        ExpectResponse(LL_SplitInto(NULL, 2, Parts), LL_NOT_OK);
+        ExpectResponse(LL_SplitInto(List, 0, Parts), LL_NOT_OK);
+        ExpectResponse(LL_SplitInto(List, 2, NULL), LL_NOT_OK);
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_SplitAfter(LL_GetHead(List), NULL), LL_NOT_OK);
+        ExpectPtrNull(NewList);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: The nodes after a node move to a new list */
+            List = LL_NewList(Linkage);
+            ExpectResponse(LL_AddArrayToBack(List, All, 5), LL_OK);
+            ExpectResponse(LL_SplitAfter(LL_GetNodeAt(List, 1), &NewList), LL_OK);
+            ExpectListWithIds(List, (int[]){101, 102}, 2);
+            ExpectListWithIds(NewList, (int[]){103, 104, 105}, 3);
+            ExpectEqual(NewList->Linkage, Linkage);
+
+            /* Test 3: Splitting after the tail gives an empty list */
+            List_t* Empty = NULL;
+            ExpectResponse(LL_SplitAfter(LL_GetTail(NewList), &Empty), LL_OK);
+            ExpectEmptyList(Empty);
+            ExpectResponse(LL_DeleteList(Empty), LL_OK);
+
+            /* Test 4: Both lists keep working after the other one is deleted */
+            ExpectResponse(LL_RemoveNode(LL_GetHead(NewList)), LL_OK);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+            ExpectResponse(LL_AddToFront(NewList, &TestData[0]), LL_OK);
+            ExpectListWithIds(NewList, (int[]){101, 104, 105}, 3);
+
+            /* Test 5: A list splits into parts of nearly equal lengths, the longer ones first */
+            ExpectResponse(LL_AddArrayToBack(NewList, All, 5), LL_OK);
+            ExpectResponse(LL_SplitInto(NewList, 3, Parts), LL_OK);
+            ExpectEqualPtr(Parts[0], NewList);
+            ExpectListWithIds(Parts[0], (int[]){101, 104, 105}, 3);
+            ExpectListWithIds(Parts[1], (int[]){101, 102, 103}, 3);
+            ExpectListWithIds(Parts[2], (int[]){104, 105}, 2);
+            for(unsigned int i = 0; i < 3; i++)
+            {
+                ExpectResponse(LL_DeleteList(Parts[i]), LL_OK);
+            }
+
+            /* Test 6: Splitting into more parts than nodes leaves the last parts empty */
+            List = LL_NewList(Linkage);
+            ExpectResponse(LL_AddArrayToBack(List, All, 2), LL_OK);
+            ExpectResponse(LL_SplitInto(List, 4, Parts), LL_OK);
+            ExpectListWithIds(Parts[0], (int[]){101}, 1);
+            ExpectListWithIds(Parts[1], (int[]){102}, 1);
+            ExpectEmptyList(Parts[2]);
+            ExpectEmptyList(Parts[3]);
+            for(unsigned int i = 4; i > 0; i--)
+            {
+                ExpectResponse(LL_DeleteList(Parts[i - 1]), LL_OK);
+            }
+        }
+
+        /* Test 7: Splitting doesn't allocate nodes, the parts keep the order and indexes of the source stay consistent */
+        TestAllocator_t Allocator = {0, 0};
+        List = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        for(unsigned int i = 0; i < 1000; i++)
+        {
+            Items[i].Id = (int)i;
+            Pointers[i] = &Items[i];
+        }
+        ExpectResponse(LL_AddArrayToBack(List, Pointers, 1000), LL_OK);
+        ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+        unsigned int NumAllocs = Allocator.NumAllocs;
+        ExpectResponse(LL_SplitInto(List, 3, Parts), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, NumAllocs + 3);
+        unsigned int Mismatches = 0;
+        unsigned int Expected = 0;
+        for(unsigned int i = 0; i < 3; i++)
+        {
+            ExpectEqual(Parts[i]->Count, (i == 0 ? 334 : 333));
+            for(ListNode_t* Node = LL_GetHead(Parts[i]); Node; Node = LL_GetNext(Node))
+            {
+                Mismatches += (LL_GetData(Node) != &Items[Expected++]);
+            }
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectEqual(Expected, 1000);
+        ExpectEqualPtr(LL_GetNodeByData(Parts[0], &Items[333]), LL_GetTail(Parts[0]));
+        ExpectPtrNull(LL_GetNodeByData(Parts[0], &Items[334]));
+        ExpectResponse(LL_Concat(Parts[0], Parts[2]), LL_OK);
+        ExpectResponse(LL_Concat(Parts[0], Parts[1]), LL_OK);
+        ExpectEqual(Parts[0]->Count, 1000);
+        ExpectEqualPtr(LL_GetNodeByData(Parts[0], &Items[334]), LL_GetNodeAt(Parts[0], 667));
+        ExpectResponse(LL_DeleteList(Parts[0]), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+
+        /* Test 8: The parts of a sorted list are sorted */
+        List = LL_NewSortedList(LL_DOUBLE, CompareInts);
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            ExpectResponse(LL_Insert(List, &TestData[4 - i]), LL_OK);
+        }
+        ExpectResponse(LL_SplitAfter(LL_Find(List, &TestData[2]), &NewList), LL_OK);
+        ExpectResponse(LL_Insert(NewList, &TestData[0]), LL_OK);
+        ExpectListWithIds(NewList, (int[]){101, 104, 105}, 3);
+        ExpectEqualPtr(LL_Find(List, &TestData[1]), LL_GetNodeAt(List, 1));
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        ExpectResponse(LL_DeleteList(NewList), LL_OK);
+
+        /* Test 9: The parts of a sorted doubly linked list have a position index, for their ordered inserts */
+        List = LL_NewSortedList(LL_DOUBLE, CompareInts);
+        for(unsigned int i = 0; i < 300; i++)
+        {
+            ExpectResponse(LL_Insert(List, &Items[299 - i]), LL_OK);
+        }
+        ExpectResponse(LL_SplitInto(List, 3, Parts), LL_OK);
+        for(unsigned int i = 0; i < 3; i++)
+        {
+            ExpectPtrNotNull(Parts[i]->SkipIndex);
+            ExpectResponse(LL_Insert(Parts[i], &Items[i * 100 + 50]), LL_OK);
+            ExpectEqual(Parts[i]->Count, 101);
+            ExpectEqualPtr(LL_GetData(LL_GetNodeAt(Parts[i], 51)), &Items[i * 100 + 50]);
+            ExpectEqualPtr(LL_GetData(LL_GetNodeAt(Parts[i], 100)), &Items[i * 100 + 99]);
+        }
+        for(unsigned int i = 0; i < 3; i++)
+        {
+            ExpectResponse(LL_DeleteList(Parts[i]), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 38: LL_Clear Tests");
+    {
+        static TestData_t Items[200];
+        static void* Pointers[200];
+        void* All[] = {&TestData[0], &TestData[1], &TestData[2], &TestData[3], &TestData[4]};
+
+        /* Test 1: NULL list should fail */
+        ExpectResponse(LL_Clear(NULL), LL_NOT_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: A cleared list is empty and can be filled again */
+            List_t* List = LL_NewList(Linkage);
+            ExpectResponse(LL_Clear(List), LL_OK);
+            ExpectEmptyList(List);
+            ExpectResponse(LL_AddArrayToBack(List, All, 5), LL_OK);
+            ExpectResponse(LL_Clear(List), LL_OK);
+            ExpectEmptyList(List);
+            ExpectResponse(LL_AddToBack(List, &TestData[2]), LL_OK);
+            ExpectResponse(LL_AddArrayToFront(List, All, 2), LL_OK);
+            ExpectListWithIds(List, (int[]){101, 102, 103}, 3);
+
+            /* Test 3: Clearing a list that shares its chunks leaves the other list intact */
+            List_t* Other = NULL;
+            ExpectResponse(LL_SplitAfter(LL_GetHead(List), &Other), LL_OK);
+            ExpectResponse(LL_Clear(List), LL_OK);
+            ExpectEmptyList(List);
+            ExpectResponse(LL_AddArrayToBack(List, &All[3], 2), LL_OK);
+            ExpectListWithIds(Other, (int[]){102, 103}, 2);
+            ExpectListWithIds(List, (int[]){104, 105}, 2);
+            ExpectResponse(LL_Concat(Other, List), LL_OK);
+            ExpectResponse(LL_Clear(Other), LL_OK);
+            ExpectEmptyList(Other);
+            ExpectResponse(LL_DeleteList(Other), LL_OK);
+        }
+
+        /* Test 4: Clearing keeps a single chunk, and the indexes stay enabled and consistent */
+        TestAllocator_t Allocator = {0, 0};
+        List_t* List = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        for(unsigned int i = 0; i < 200; i++)
+        {
+            Items[i].Id = (int)i;
+            Pointers[i] = &Items[i];
+        }
+        for(unsigned int i = 0; i < 200; i++)
+        {
+            ExpectResponse(LL_AddToBack(List, Pointers[i]), LL_OK);
+        }
+        ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+        ExpectResponse(LL_EnablePositionIndex(List), LL_OK);
+        ExpectResponse(LL_EnableBloomFilter(List), LL_OK);
+        unsigned int NumLive = Allocator.NumAllocs - Allocator.NumFrees;
+        ExpectResponse(LL_Clear(List), LL_OK);
+        ExpectEmptyList(List);
+        ExpectPtrNull(LL_GetNodeByData(List, &Items[5]));
+        ExpectPtrNull(LL_GetNodeAt(List, 0));
+        ExpectEqual(Allocator.NumAllocs - Allocator.NumFrees < NumLive, 1);
+        ExpectResponse(LL_AddArrayToBack(List, &Pointers[100], 100), LL_OK);
+        unsigned int Mismatches = 0;
+        unsigned int Index = 0;
+        for(unsigned int i = 0; i < 100; i++)
+        {
+            ListNode_t* Node = LL_GetNodeAt(List, i);
+            Mismatches += (LL_GetData(Node) != &Items[100 + i]);
+            Mismatches += (LL_GetNodeIndex(Node, &Index) != LL_OK) || (Index != i);
+            Mismatches += (LL_GetNodeByData(List, &Items[100 + i]) != Node);
+            Mismatches += (LL_GetNodeByData(List, &Items[i]) != NULL);
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 39: LL_ToArray, LL_FromArray and LL_GetArrayView Tests");
+    {
+        void* All[] = {&TestData[0], &TestData[1], &TestData[2], &TestData[3], &TestData[4]};
+        void* Out[8] = {NULL};
+        unsigned int NumData = 0;
+        ListArrayView_t View;
+
+        /* Test 1: NULL arguments and NULL data should fail */
+        List_t* List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_ToArray(NULL, Out, 8, &NumData), LL_NOT_OK);
+        ExpectResponse(LL_ToArray(List, NULL, 8, &NumData), LL_NOT_OK);
+        ExpectResponse(LL_ToArray(List, Out, 8, NULL), LL_NOT_OK);
+        ExpectResponse(LL_GetArrayView(NULL, &View), LL_NOT_OK);
+        ExpectResponse(LL_GetArrayView(List, NULL), LL_NOT_OK);
+        ExpectPtrNull(LL_FromArray(LL_DOUBLE, NULL, 2));
+        ExpectPtrNull(LL_FromArray(LL_DOUBLE, (void*[]){&TestData[0], NULL}, 2));
+        ExpectPtrNull(LL_FromArray((ListLinkage_t)7, All, 2));
+
+        /* Test 2: An empty list gives no data and an empty view */
+        ExpectResponse(LL_ToArray(List, Out, 8, &NumData), LL_OK);
+        ExpectEqual(NumData, 0);
+        ExpectResponse(LL_GetArrayView(List, &View), LL_OK);
+        ExpectEqual(View.Count, 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 3: A list built from an array has the data in order and can be viewed as an array */
+            List = LL_FromArray(Linkage, All, 5);
+            ExpectListWithIds(List, (int[]){101, 102, 103, 104, 105}, 5);
+            ExpectResponse(LL_GetArrayView(List, &View), LL_OK);
+            ExpectEqual(View.Count, 5);
+            for(unsigned int i = 0; i < 5; i++)
+            {
+                ExpectEqualPtr(LL_VIEW_DATA(&View, i), All[i]);
+            }
+
+            /* Test 4: The view stays available while data is only added to the back and removed from the ends */
+            ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+            ExpectResponse(LL_RemoveTail(List), LL_OK);
+            ExpectResponse(LL_AddToBack(List, &TestData[1]), LL_OK);
+            ExpectResponse(LL_RemoveHead(List), LL_OK);
+            ExpectResponse(LL_GetArrayView(List, &View), LL_OK);
+            ExpectEqual(View.Count, 5);
+            ExpectEqualPtr(LL_VIEW_DATA(&View, 0), &TestData[1]);
+            ExpectEqualPtr(LL_VIEW_DATA(&View, 4), &TestData[1]);
+
+            /* Test 5: Data copied out, all of it or up to the size of the array, with or without a view */
+            ExpectResponse(LL_ToArray(List, Out, 8, &NumData), LL_OK);
+            ExpectEqual(NumData, 5);
+            ExpectEqualPtr(Out[3], &TestData[4]);
+            ExpectResponse(LL_AddToFront(List, &TestData[0]), LL_OK);
+            ExpectResponse(LL_GetArrayView(List, &View), LL_NOT_OK);
+            ExpectResponse(LL_ToArray(List, Out, 3, &NumData), LL_OK);
+            ExpectEqual(NumData, 3);
+            ExpectEqualPtr(Out[0], &TestData[0]);
+            ExpectEqualPtr(Out[1], &TestData[1]);
+            ExpectEqualPtr(Out[2], &TestData[2]);
+            ExpectResponse(LL_ToArray(List, Out, 8, &NumData), LL_OK);
+            ExpectEqual(NumData, 6);
+            ExpectEqualPtr(Out[5], &TestData[1]);
+
+            /* Test 6: A cleared list can be viewed again */
+            ExpectResponse(LL_Clear(List), LL_OK);
+            ExpectResponse(LL_AddArrayToBack(List, All, 3), LL_OK);
+            ExpectResponse(LL_GetArrayView(List, &View), LL_OK);
+            ExpectEqualPtr(LL_VIEW_DATA(&View, 2), &TestData[2]);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 7: The view of an inline list gives the values inside the nodes */
+        List = LL_NewInlineList(LL_SINGLE, sizeof(int));
+        for(int i = 0; i < 4; i++)
+        {
+            ExpectResponse(LL_AddToBack(List, &i), LL_OK);
+        }
+        ExpectResponse(LL_GetArrayView(List, &View), LL_OK);
+        ExpectEqual(*(int*)LL_VIEW_DATA(&View, 3), 3);
+        ExpectResponse(LL_ToArray(List, Out, 8, &NumData), LL_OK);
+        ExpectEqual(*(int*)Out[2], 2);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 40: LL_Sort Tests");
+    {
+        static TestData_t Items[1000];
+        TestData_t Keys[6] = {{.Id = 3}, {.Id = 1}, {.Id = 3}, {.Id = 2}, {.Id = 1}, {.Id = 3}};
+        void* All[] = {&TestData[0], &TestData[1], &TestData[2], &TestData[3], &TestData[4]};
+
+        /* Test 1: NULL arguments and sorted lists should fail, short lists are already sorted */
+        List_t* List = LL_NewSortedList(LL_DOUBLE, CompareInts);
+        ExpectResponse(LL_Sort(NULL, CompareInts), LL_NOT_OK);
+        ExpectResponse(LL_Sort(List, CompareInts), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_Sort(List, NULL), LL_NOT_OK);
+        ExpectResponse(LL_Sort(List, CompareInts), LL_OK);
+        ExpectEmptyList(List);
+        ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+        ExpectResponse(LL_Sort(List, CompareInts), LL_OK);
+        ExpectListWithIds(List, (int[]){101}, 1);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 2: The nodes are relinked in order, the list keeps working */
+            List = LL_NewList(Linkage);
+            for(unsigned int i = 0; i < 5; i++)
+            {
+                ExpectResponse(LL_AddToFront(List, All[(i * 2) % 5]), LL_OK);
+            }
+            ExpectListWithIds(List, (int[]){104, 102, 105, 103, 101}, 5);
+            ExpectResponse(LL_Sort(List, CompareInts), LL_OK);
+            ExpectListWithIds(List, (int[]){101, 102, 103, 104, 105}, 5);
+            ExpectResponse(LL_RemoveNodeByData(List, &TestData[2]), LL_OK);
+            ExpectResponse(LL_AddToBack(List, &TestData[2]), LL_OK);
+            ExpectResponse(LL_RemoveTail(List), LL_OK);
+            ExpectListWithIds(List, (int[]){101, 102, 104, 105}, 4);
+
+            /* Test 3: The sort is stable */
+            ExpectResponse(LL_Clear(List), LL_OK);
+            for(unsigned int i = 0; i < 6; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &Keys[i]), LL_OK);
+            }
+            ExpectResponse(LL_Sort(List, CompareInts), LL_OK);
+            unsigned int Order[6] = {1, 4, 3, 0, 2, 5};
+            ListCursor_t Cursor;
+            ExpectResponse(LL_CursorToHead(List, &Cursor), LL_OK);
+            for(unsigned int i = 0; i < 6; i++)
+            {
+                ExpectEqualPtr(LL_GetData(LL_CursorGetNode(&Cursor)), &Keys[Order[i]]);
+                LL_CursorNext(&Cursor);
+            }
+            ExpectEqualPtr(LL_GetData(LL_GetTail(List)), &Keys[5]);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 4: A long list is sorted without allocating memory, and its indexes stay consistent */
+        TestAllocator_t Allocator = {0, 0};
+        List = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        uint32_t Seed = 12345;
+        for(unsigned int i = 0; i < 1000; i++)
+        {
+            Seed = Seed * 1103515245u + 12345u;
+            Items[i].Id = (int)((Seed >> 16) % 500);
+            ExpectResponse(LL_AddToBack(List, &Items[i]), LL_OK);
+        }
+        ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+        ExpectResponse(LL_EnablePositionIndex(List), LL_OK);
+        unsigned int NumAllocs = Allocator.NumAllocs;
+        ExpectResponse(LL_Sort(List, CompareInts), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, NumAllocs);
+        unsigned int Mismatches = 0;
+        unsigned int Index = 0;
+        ListNode_t* Prev = NULL;
+        for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetNext(Node))
+        {
+            TestData_t* Data = LL_GetData(Node);
+            if(Prev)
+            {
+                TestData_t* PrevData = LL_GetData(Prev);
+                Mismatches += (PrevData->Id > Data->Id) || ((PrevData->Id == Data->Id) && (PrevData > Data));
+            }
+            Mismatches += (LL_GetPrev(Node) != Prev);
+            Mismatches += (LL_GetNodeIndex(Node, &Index) != LL_OK) || (LL_GetNodeAt(List, Index) != Node);
+            Mismatches += (LL_GetNodeByData(List, Data) != Node);
+            Prev = Node;
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectEqualPtr(LL_GetTail(List), Prev);
+        ExpectResponse(LL_RemoveAt(List, 500), LL_OK);
+        ExpectResponse(LL_InsertAt(List, 10, &Items[0]), LL_OK);
+        ExpectEqualPtr(LL_GetData(LL_GetNodeAt(List, 10)), &Items[0]);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 41: LL_ParallelSort Tests");
+    {
+        static TestData_t Items[100000];
+        static void* Sorted[100000];
+        uint32_t Seed = 777;
+        for(unsigned int i = 0; i < 100000; i++)
+        {
+            Seed = Seed * 1103515245u + 12345u;
+            Items[i].Id = (int)((Seed >> 16) % 5000);
+        }
+
+        /* Test 1: NULL arguments and sorted lists should fail */
+        List_t* List = LL_NewSortedList(LL_DOUBLE, CompareInts);
+        ExpectResponse(LL_ParallelSort(NULL, CompareInts, 4), LL_NOT_OK);
+        ExpectResponse(LL_ParallelSort(List, CompareInts, 4), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+        List = LL_NewList(LL_SINGLE);
+        ExpectResponse(LL_ParallelSort(List, NULL, 4), LL_NOT_OK);
+        ExpectResponse(LL_ParallelSort(List, CompareInts, 4), LL_OK);
+        ExpectEmptyList(List);
+
+        /* Test 2: A short list is sorted by the calling thread, like LL_Sort */
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            ExpectResponse(LL_AddToFront(List, &TestData[(i * 2) % 5]), LL_OK);
+        }
+        ExpectResponse(LL_ParallelSort(List, CompareInts, 8), LL_OK);
+        ExpectListWithIds(List, (int[]){101, 102, 103, 104, 105}, 5);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            for(unsigned int NumThreads = 0; NumThreads <= 5; NumThreads += 5)
+            {
+                /* Test 3: A long list is sorted by several threads, the sort is stable and the nodes are
+                   linked both ways */
+                TestAllocator_t Allocator = {0, 0};
+                List = LL_NewListWithAllocator(Linkage, TestAlloc, TestFree, &Allocator);
+                for(unsigned int i = 0; i < 100000; i++)
+                {
+                    ExpectResponse(LL_AddToBack(List, &Items[i]), LL_OK);
+                }
+                if(Linkage == LL_DOUBLE)
+                {
+                    ExpectResponse(LL_EnableHashIndex(List), LL_OK);
+                }
+                ExpectResponse(LL_ParallelSort(List, CompareInts, NumThreads), LL_OK);
+
+                unsigned int Mismatches = 0;
+                unsigned int Count = 0;
+                ListCursor_t Cursor;
+                ExpectResponse(LL_CursorToHead(List, &Cursor), LL_OK);
+                for(ListStatus_t Status = LL_OK; Status == LL_OK; Status = LL_CursorNext(&Cursor))
+                {
+                    ListNode_t* Node = LL_CursorGetNode(&Cursor);
+                    TestData_t* Data = LL_GetData(Node);
+                    if(Count > 0)
+                    {
+                        TestData_t* PrevData = Sorted[Count - 1];
+                        Mismatches += (PrevData->Id > Data->Id) || ((PrevData->Id == Data->Id) && (PrevData > Data));
+                    }
+                    if(Linkage == LL_DOUBLE)
+                    {
+                        Mismatches += (LL_GetNodeByData(List, Data) != Node);
+                    }
+                    Sorted[Count++] = Data;
+                }
+                ExpectEqual(Count, 100000);
+                ExpectEqual(Mismatches, 0);
+                ExpectEqualPtr(LL_GetData(LL_GetTail(List)), Sorted[99999]);
+                if(Linkage != LL_SINGLE)
+                {
+                    ExpectResponse(LL_CursorToTail(List, &Cursor), LL_OK);
+                    for(unsigned int i = 100000; i > 0; i--)
+                    {
+                        Mismatches += (LL_GetData(LL_CursorGetNode(&Cursor)) != Sorted[i - 1]);
+                        Mismatches += (LL_CursorPrev(&Cursor) != (i > 1 ? LL_OK : LL_NOT_OK));
+                    }
+                    ExpectEqual(Mismatches, 0);
+                }
+
+                /* Test 4: The list keeps working, all the memory is released with it */
+                ExpectResponse(LL_RemoveHead(List), LL_OK);
+                ExpectResponse(LL_AddToBack(List, Sorted[0]), LL_OK);
+                ExpectEqualPtr(LL_GetData(LL_GetTail(List)), Sorted[0]);
+                ExpectResponse(LL_DeleteList(List), LL_OK);
+                ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+            }
+        }
+
+        /* Test 5: Data equal to the splitters (a few distinct values, or a single one) is sorted stably */
+        for(unsigned int NumValues = 1; NumValues <= 3; NumValues += 2)
+        {
+            List = LL_NewList(LL_DOUBLE);
+            for(unsigned int i = 0; i < 100000; i++)
+            {
+                Items[i].Id = (int)((i * 7) % NumValues);
+                ExpectResponse(LL_AddToBack(List, &Items[i]), LL_OK);
+            }
+            ExpectResponse(LL_ParallelSort(List, CompareInts, 5), LL_OK);
+
+            unsigned int Mismatches = 0;
+            unsigned int Count = 0;
+            TestData_t* PrevData = NULL;
+            for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetNext(Node))
+            {
+                TestData_t* Data = LL_GetData(Node);
+                if(PrevData)
+                {
+                    Mismatches += (PrevData->Id > Data->Id) || ((PrevData->Id == Data->Id) && (PrevData > Data));
+                }
+                PrevData = Data;
+                Count++;
+            }
+            ExpectEqual(Count, 100000);
+            ExpectEqual(Mismatches, 0);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 6: Short lists, which only take the threads when the tests are built with a small
+           LL_SORT_MIN_NODES_PER_THREAD (fewer nodes per thread than samples per thread) */
+        for(unsigned int NumNodes = 2; NumNodes <= 600; NumNodes = NumNodes * 3 + 2)
+        {
+            List = LL_NewList(LL_SINGLE);
+            for(unsigned int i = 0; i < NumNodes; i++)
+            {
+                Items[i].Id = (int)((i * 7919) % NumNodes);
+                ExpectResponse(LL_AddToBack(List, &Items[i]), LL_OK);
+            }
+            ExpectResponse(LL_ParallelSort(List, CompareInts, 2), LL_OK);
+
+            unsigned int Mismatches = 0;
+            int Expected = 0;
+            for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetNext(Node))
+            {
+                Mismatches += (((TestData_t*)LL_GetData(Node))->Id != Expected++);
+            }
+            ExpectEqual((unsigned int)Expected, NumNodes);
+            ExpectEqual(Mismatches, 0);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 42: LL_MergeSorted Tests");
+    {
+        static TestData_t Items[3000];
+        static List_t* Lists[150];
+        TestData_t Keys[7] = {{.Id = 1}, {.Id = 3}, {.Id = 2}, {.Id = 3}, {.Id = 1}, {.Id = 2}, {.Id = 4}};
+
+        /* Test 1: Invalid arguments should fail and leave the lists unchanged */
+        List_t* Out = LL_NewList(LL_DOUBLE);
+        Lists[0] = LL_NewList(LL_DOUBLE);
+        List_t* Single = LL_NewList(LL_SINGLE);
+        Lists[1] = Single;
+        ExpectResponse(LL_AddToBack(Lists[0], &TestData[0]), LL_OK);
+        ExpectResponse(LL_MergeSorted(NULL, 1, CompareInts, Out), LL_NOT_OK);
+        ExpectResponse(LL_MergeSorted(Lists, 1, NULL, Out), LL_NOT_OK);
+        ExpectResponse(LL_MergeSorted(Lists, 1, CompareInts, NULL), LL_NOT_OK);
+        ExpectResponse(LL_MergeSorted(Lists, 2, CompareInts, Out), LL_NOT_OK);
+        Lists[1] = Lists[0];
+        ExpectResponse(LL_MergeSorted(Lists, 2, CompareInts, Out), LL_NOT_OK);
+        Lists[1] = Out;
+        ExpectResponse(LL_MergeSorted(Lists, 2, CompareInts, Out), LL_NOT_OK);
+        ExpectResponse(LL_MergeSorted(NULL, 0, CompareInts, Out), LL_NOT_OK);
+        ExpectListWithIds(Lists[0], (int[]){101}, 1);
+        ExpectEmptyList(Out);
+        ExpectResponse(LL_MergeSorted(Lists, 0, CompareInts, Out), LL_OK);
+        ExpectEmptyList(Out);
+        ExpectResponse(LL_DeleteList(Out), LL_OK);
+        Out = LL_NewSortedList(LL_DOUBLE, CompareInts);
+        ExpectResponse(LL_MergeSorted(Lists, 1, CompareIntsDescending, Out), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(Out), LL_OK);
+        ExpectResponse(LL_DeleteList(Single), LL_OK);
+
+        /* Test 2: A sorted list stays sorted if the merge uses its comparison function */
+        Out = LL_NewSortedList(LL_DOUBLE, CompareInts);
+        ExpectResponse(LL_Insert(Out, &TestData[2]), LL_OK);
+        Lists[1] = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_AddToBack(Lists[1], &TestData[1]), LL_OK);
+        ExpectResponse(LL_AddToBack(Lists[1], &TestData[3]), LL_OK);
+        ExpectResponse(LL_MergeSorted(Lists, 2, CompareInts, Out), LL_OK);
+        ExpectListWithIds(Out, (int[]){101, 102, 103, 104}, 4);
+        ExpectResponse(LL_Insert(Out, &TestData[4]), LL_OK);
+        ExpectEqualPtr(LL_GetData(LL_Find(Out, &TestData[2])), &TestData[2]);
+        ExpectListWithIds(Out, (int[]){101, 102, 103, 104, 105}, 5);
+        ExpectResponse(LL_DeleteList(Out), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 3: The merge is stable, an empty list is merged too and no memory is allocated */
+            TestAllocator_t Allocator = {0, 0};
+            Out = LL_NewListWithAllocator(Linkage, TestAlloc, TestFree, &Allocator);
+            for(unsigned int i = 0; i < 4; i++)
+            {
+                Lists[i] = LL_NewListWithAllocator(Linkage, TestAlloc, TestFree, &Allocator);
+            }
+            unsigned int Sources[7] = {0, 2, 0, 2, 1, 1, 2};
+            for(unsigned int i = 0; i < 7; i++)
+            {
+                ExpectResponse(LL_AddToBack(Lists[Sources[i]], &Keys[i]), LL_OK);
+            }
+            unsigned int NumAllocs = Allocator.NumAllocs;
+            ExpectResponse(LL_MergeSorted(Lists, 4, CompareInts, Out), LL_OK);
+            ExpectEqual(Allocator.NumAllocs, NumAllocs);
+            unsigned int Order[7] = {0, 4, 2, 5, 1, 3, 6};
+            ListCursor_t Cursor;
+            ExpectResponse(LL_CursorToHead(Out, &Cursor), LL_OK);
+            for(unsigned int i = 0; i < 7; i++)
+            {
+                ExpectEqualPtr(LL_GetData(LL_CursorGetNode(&Cursor)), &Keys[Order[i]]);
+                LL_CursorNext(&Cursor);
+            }
+            ExpectEqualPtr(LL_GetData(LL_GetTail(Out)), &Keys[6]);
+            if(Linkage != LL_SINGLE)
+            {
+                ExpectResponse(LL_CursorToTail(Out, &Cursor), LL_OK);
+                for(unsigned int i = 7; i > 0; i--)
+                {
+                    ExpectEqualPtr(LL_GetData(LL_CursorGetNode(&Cursor)), &Keys[Order[i - 1]]);
+                    LL_CursorPrev(&Cursor);
+                }
+            }
+
+            /* Test 4: The moved nodes belong to Out */
+            ExpectResponse(LL_CursorToHead(Out, &Cursor), LL_OK);
+            LL_CursorNext(&Cursor);
+            ExpectResponse(LL_CursorRemove(&Cursor), LL_OK);
+            ExpectResponse(LL_RemoveTail(Out), LL_OK);
+            ExpectResponse(LL_AddToFront(Out, &Keys[6]), LL_OK);
+            ExpectListWithIds(Out, (int[]){4, 1, 2, 2, 3, 3}, 6);
+            ExpectResponse(LL_DeleteList(Out), LL_OK);
+            ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+        }
+
+        /* Test 5: More lists than the heap holds are merged in rounds, with the nodes of Out */
+        uint32_t Seed = 99;
+        unsigned int NumItems = 0;
+        Out = LL_NewList(LL_DOUBLE);
+        for(unsigned int i = 0; i <= 150; i++)
+        {
+            List_t* List = (i == 0 ? Out : LL_NewList(LL_DOUBLE));
+            int Id = 0;
+            for(unsigned int n = (i * 7) % 31; n > 0; n--)
+            {
+                Seed = Seed * 1103515245u + 12345u;
+                Id += (int)((Seed >> 16) % 3);
+                Items[NumItems].Id = Id;
+                ExpectResponse(LL_AddToBack(List, &Items[NumItems++]), LL_OK);
+            }
+            if(i > 0)
+            {
+                Lists[i - 1] = List;
+            }
+        }
+        ExpectResponse(LL_EnableHashIndex(Out), LL_OK);
+        ExpectResponse(LL_MergeSorted(Lists, 150, CompareInts, Out), LL_OK);
+        unsigned int Count = 0;
+        unsigned int Mismatches = 0;
+        ListNode_t* Prev = NULL;
+        for(ListNode_t* Node = LL_GetHead(Out); Node; Node = LL_GetNext(Node))
+        {
+            TestData_t* Data = LL_GetData(Node);
+            if(Prev)
+            {
+                TestData_t* PrevData = LL_GetData(Prev);
+                Mismatches += (PrevData->Id > Data->Id) || ((PrevData->Id == Data->Id) && (PrevData > Data));
+            }
+            Mismatches += (LL_GetPrev(Node) != Prev);
+            Mismatches += (LL_GetNodeByData(Out, Data) != Node);
+            Prev = Node;
+            Count++;
+        }
+        ExpectEqual(Count, NumItems);
+        ExpectEqual(Mismatches, 0);
+        ExpectEqualPtr(LL_GetTail(Out), Prev);
+        LL_GetCount(Out, &Count);
+        ExpectEqual(Count, NumItems);
+        ExpectResponse(LL_DeleteList(Out), LL_OK);
+
+        /* Test 6: Merging only empty lists doesn't reserve anything, even with a position index */
+        TestAllocator_t Allocator = {0, 0};
+        Out = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        ExpectResponse(LL_EnablePositionIndex(Out), LL_OK);
+        ExpectResponse(LL_AddToBack(Out, &TestData[0]), LL_OK);
+        Lists[0] = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        Lists[1] = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        ExpectResponse(LL_MergeSorted(Lists, 2, CompareInts, Out), LL_OK);
+        ExpectListWithIds(Out, (int[]){101}, 1);
+        ExpectResponse(LL_DeleteList(Out), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 43: LL_Reverse Tests");
+    {
+        static TestData_t Items[1000];
+
+        /* Test 1: NULL and sorted lists should fail, short lists are unchanged */
+        ExpectResponse(LL_Reverse(NULL), LL_NOT_OK);
+        List_t* List = LL_NewSortedList(LL_SINGLE, CompareInts);
+        ExpectResponse(LL_Reverse(List), LL_NOT_OK);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            List = LL_NewList(Linkage);
+            ExpectResponse(LL_Reverse(List), LL_OK);
+            ExpectEmptyList(List);
+            ExpectResponse(LL_AddToBack(List, &TestData[0]), LL_OK);
+            ExpectResponse(LL_Reverse(List), LL_OK);
+            ExpectListWithIds(List, (int[]){101}, 1);
+
+            /* Test 2: The nodes are reversed in both directions and keep belonging to the list */
+            for(unsigned int i = 1; i < 5; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[i]), LL_OK);
+            }
+            ExpectResponse(LL_Reverse(List), LL_OK);
+            ExpectListWithIds(List, (int[]){105, 104, 103, 102, 101}, 5);
+            ExpectResponse(LL_RemoveNode(LL_GetNodeByData(List, &TestData[2])), LL_OK);
+            ExpectResponse(LL_AddToBack(List, &TestData[2]), LL_OK);
+            ExpectListWithIds(List, (int[]){105, 104, 102, 101, 103}, 5);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+        }
+
+        /* Test 3: The position index follows the new order */
+        List = LL_NewList(LL_DOUBLE);
+        ExpectResponse(LL_EnablePositionIndex(List), LL_OK);
+        for(unsigned int i = 0; i < 200; i++)
+        {
+            ExpectResponse(LL_AddToBack(List, &Items[i]), LL_OK);
+        }
+        ExpectResponse(LL_Reverse(List), LL_OK);
+        unsigned int Mismatches = 0;
+        for(unsigned int i = 0; i < 200; i++)
+        {
+            Mismatches += (LL_GetData(LL_GetNodeAt(List, i)) != &Items[199 - i]);
+        }
+        ExpectEqual(Mismatches, 0);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+
+        /* Test 4: A singly linked list is drained from the back by reversing it once */
+        List = LL_NewList(LL_SINGLE);
+        for(unsigned int i = 0; i < 1000; i++)
+        {
+            ExpectResponse(LL_AddToBack(List, &Items[i]), LL_OK);
+        }
+        ExpectResponse(LL_Reverse(List), LL_OK);
+        unsigned int NumDrained = 0;
+        Mismatches = 0;
+        for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetHead(List))
+        {
+            Mismatches += (LL_GetData(Node) != &Items[999 - NumDrained++]);
+            ExpectResponse(LL_RemoveHead(List), LL_OK);
+        }
+        ExpectEqual(NumDrained, 1000);
+        ExpectEqual(Mismatches, 0);
+        ExpectEmptyList(List);
+        ExpectResponse(LL_DeleteList(List), LL_OK);
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 44: Concurrent use of split lists");
+    {
+        static void* Pointers[4000];
+        List_t* Parts[4];
+        TestWorker_t Workers[4];
+        TestSharedAllocator_t Allocator;
+        Allocator.Counts.NumAllocs = Allocator.Counts.NumFrees = 0;
+#if defined(_WIN32)
+        InitializeCriticalSection(&Allocator.Mutex);
+#else
+        pthread_mutex_init(&Allocator.Mutex, NULL);
+#endif
+
+        /* Test 1: Each part of a split list is changed by its own thread, while the others change theirs */
+        List_t* List = LL_NewListWithAllocator(LL_DOUBLE, TestSharedAlloc, TestSharedFree, &Allocator);
+        for(unsigned int i = 0; i < 4000; i++)
+        {
+            Pointers[i] = &TestData[i % 5];
+        }
+        ExpectResponse(LL_AddArrayToBack(List, Pointers, 4000), LL_OK);
+        ExpectResponse(LL_SplitInto(List, 4, Parts), LL_OK);
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            Workers[i].List = Parts[i];
+            Workers[i].NumErrors = 0;
+        }
+        RunWorkers(ChurnSplitPart, Workers, 4);
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            ExpectEqual(Workers[i].NumErrors, 0);
+            ExpectEqual(Parts[i]->Count, 1000 + 200 * 25);
+        }
+
+        /* Test 2: The parts can be put back together, all the memory is released with them */
+        for(unsigned int i = 1; i < 4; i++)
+        {
+            ExpectResponse(LL_Concat(Parts[0], Parts[i]), LL_OK);
+        }
+        ExpectEqual(Parts[0]->Count, 4 * (1000 + 200 * 25));
+        ExpectResponse(LL_DeleteList(Parts[0]), LL_OK);
+        ExpectEqual(Allocator.Counts.NumAllocs, Allocator.Counts.NumFrees);
+#if defined(_WIN32)
+        DeleteCriticalSection(&Allocator.Mutex);
+#else
+        pthread_mutex_destroy(&Allocator.Mutex);
+#endif
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 45: Empty chunks are given back to the allocator");
+    {
+        for(ListLinkage_t Linkage = LL_SINGLE; Linkage <= LL_XOR; Linkage++)
+        {
+            /* Test 1: A queue that grew and was drained keeps only the chunk its nodes come from */
+            TestAllocator_t Allocator = {0, 0};
+            List_t* List = LL_NewListWithAllocator(Linkage, TestAlloc, TestFree, &Allocator);
+            for(unsigned int i = 0; i < 100000; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[i % 5]), LL_OK);
+            }
+            unsigned int PeakAllocs = Allocator.NumAllocs - Allocator.NumFrees;
+            for(unsigned int i = 0; i < 99990; i++)
+            {
+                ExpectResponse(LL_RemoveHead(List), LL_OK);
+            }
+            ExpectEqual(List->Count, 10);
+            ExpectEqual((Allocator.NumAllocs - Allocator.NumFrees) <= 3, 1);
+            ExpectEqual(PeakAllocs > 10, 1);
+            ExpectEqualPtr(LL_GetData(LL_GetHead(List)), &TestData[0]);
+            ExpectEqualPtr(LL_GetData(LL_GetTail(List)), &TestData[4]);
+
+            /* Test 2: The list grows again, then a stack drained from the back gives its chunks back too */
+            for(unsigned int i = 0; i < 50000; i++)
+            {
+                ExpectResponse(LL_AddToFront(List, &TestData[i % 5]), LL_OK);
+            }
+            ExpectEqual(List->Count, 50010);
+            for(unsigned int i = 0; i < 50000; i++)
+            {
+                ExpectResponse(LL_RemoveHead(List), LL_OK);
+            }
+            ExpectEqual((Allocator.NumAllocs - Allocator.NumFrees) <= 3, 1);
+            ExpectEqualPtr(LL_GetData(LL_GetHead(List)), &TestData[0]);
+
+            /* Test 3: Lists that share chunks keep them until the last of them is deleted */
+            List_t* Back = NULL;
+            for(unsigned int i = 0; i < 20000; i++)
+            {
+                ExpectResponse(LL_AddToBack(List, &TestData[i % 5]), LL_OK);
+            }
+            ExpectResponse(LL_SplitAfter(LL_GetHead(List), &Back), LL_OK);
+            for(unsigned int i = 0; i < 20000; i++)
+            {
+                ExpectResponse(LL_RemoveHead(Back), LL_OK);
+            }
+            ExpectEqual(Back->Count, 9);
+            ExpectResponse(LL_DeleteList(Back), LL_OK);
+            ExpectEqual(List->Count, 1);
+            ExpectResponse(LL_DeleteList(List), LL_OK);
+            ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+        }
+    }
+    TestEnd();
+
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    /* ---------------------------------------------------------------------------------------------------------------- */
+    TestStart("Test 46: Merged lists are released once no node refers to them");
+    {
+        /* Test 1: The nodes of C, B and A refer to C, B (which forwards to C) and A (which forwards to B) */
+        TestAllocator_t Allocator = {0, 0};
+        List_t* A = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        List_t* B = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        List_t* C = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+        for(unsigned int i = 0; i < 20; i++)
+        {
+            ExpectResponse(LL_AddToBack(A, &TestData[0]), LL_OK);
+        }
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            ExpectResponse(LL_AddToBack(B, &TestData[1]), LL_OK);
+        }
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            ExpectResponse(LL_AddToBack(C, &TestData[2]), LL_OK);
+        }
+        ExpectResponse(LL_Concat(B, A), LL_OK);
+        ExpectResponse(LL_Concat(C, B), LL_OK);
+        unsigned int NumFrees = Allocator.NumFrees;
+
+        /* B is still needed by the nodes of A after its own nodes are removed */
+        for(unsigned int i = 0; i < 15; i++)
+        {
+            ExpectResponse(LL_RemoveHead(C), LL_OK);
+        }
+        ExpectEqual(Allocator.NumFrees, NumFrees);
+        ExpectEqualPtr(LL_GetData(LL_GetNext(LL_GetHead(C))), &TestData[0]);
+        ExpectResponse(LL_RemoveNode(LL_GetTail(C)), LL_OK);
+        for(unsigned int i = 0; i < 19; i++)
+        {
+            ExpectResponse(LL_RemoveHead(C), LL_OK);
+        }
+        ExpectEqual(Allocator.NumFrees, NumFrees + 2);
+        ExpectEmptyList(C);
+
+        /* Test 2: Changing the nodes of a merged list points them to their new list, then the old one goes */
+        List_t* D = LL_NewListWithAllocator(LL_XOR, TestAlloc, TestFree, &Allocator);
+        List_t* E = LL_NewListWithAllocator(LL_XOR, TestAlloc, TestFree, &Allocator);
+        for(unsigned int i = 0; i < 10; i++)
+        {
+            ExpectResponse(LL_AddToBack(D, &TestData[i % 5]), LL_OK);
+        }
+        ExpectResponse(LL_AddToBack(E, &TestData[4]), LL_OK);
+        ExpectResponse(LL_Concat(E, D), LL_OK);
+        NumFrees = Allocator.NumFrees;
+        ListCursor_t Cursor;
+        ExpectResponse(LL_CursorToHead(E, &Cursor), LL_OK);
+        for(unsigned int i = 0; i < 11; i++)
+        {
+            if(i > 0)
+            {
+                ExpectResponse(LL_SetData(LL_CursorGetNode(&Cursor), &TestData[(i + 1) % 5]), LL_OK);
+            }
+            LL_CursorNext(&Cursor);
+        }
+        ExpectEqual(Allocator.NumFrees, NumFrees + 1);
+        ExpectEqual(E->Count, 11);
+        ExpectResponse(LL_DeleteList(E), LL_OK);
+
+        /* Test 3: The same goes for the lists merged by LL_MergeSorted */
+        static int Values[8] = {1, 3, 5, 7, 2, 4, 6, 8};
+        List_t* Merged[2];
+        for(unsigned int j = 0; j < 2; j++)
+        {
+            Merged[j] = LL_NewListWithAllocator(LL_DOUBLE, TestAlloc, TestFree, &Allocator);
+            for(unsigned int k = 0; k < 4; k++)
+            {
+                ExpectResponse(LL_AddToBack(Merged[j], &Values[4 * j + k]), LL_OK);
+            }
+        }
+        ExpectResponse(LL_MergeSorted(Merged, 2, CompareInts, C), LL_OK);
+        NumFrees = Allocator.NumFrees;
+        for(int j = 1; j <= 8; j++)
+        {
+            ExpectEqual(*(int*)LL_GetData(LL_GetHead(C)), j);
+            ExpectResponse(LL_RemoveHead(C), LL_OK);
+        }
+        ExpectEqual(Allocator.NumFrees, NumFrees + 2);
+        ExpectResponse(LL_DeleteList(C), LL_OK);
+        ExpectEqual(Allocator.NumAllocs, Allocator.NumFrees);
+
+        /* Test 4: Threads read a list made of merged lists at the same time */
+        TestWorker_t Workers[4];
+        List_t* List = LL_NewList(LL_DOUBLE);
+        for(unsigned int Part = 0; Part < 4; Part++)
+        {
+            List_t* Other = LL_NewList(LL_DOUBLE);
+            for(unsigned int j = 0; j < 1000; j++)
+            {
+                ExpectResponse(LL_AddToBack(Other, &TestData[j % 5]), LL_OK);
+            }
+            ExpectResponse(LL_Concat(List, Other), LL_OK);
+        }
+        for(unsigned int j = 0; j < 4; j++)
+        {
+            Workers[j].List = List;
+            Workers[j].NumErrors = 0;
+        }
+        RunWorkers(ReadMergedList, Workers, 4);
+        for(unsigned int j = 0; j < 4; j++)
+        {
+            ExpectEqual(Workers[j].NumErrors, 0);
+        }
+        ExpectResponse(LL_DeleteList(List), LL_OK);
     }
     TestEnd();
 
@@ -1376,6 +3892,37 @@ static void ExpectListWith5Nodes(List_t* List, int Id1, int Id2, int Id3, int Id
     }
 }
 
+static void ExpectListWithIds(List_t* List, const int* Ids, unsigned int NumIds)
+{
+    unsigned int NodeCount;
+    ListCursor_t Cursor;
+    ExpectPtrNotNull(List);
+    ExpectResponse(LL_GetCount(List, &NodeCount), LL_OK);
+    ExpectEqual(NodeCount, NumIds);
+
+    /* Traverse forward with a cursor */
+    ExpectResponse(LL_CursorToHead(List, &Cursor), LL_OK);
+    ExpectEqualPtr(LL_CursorGetNode(&Cursor), LL_GetHead(List));
+    for(unsigned int i = 0; i < NumIds; i++)
+    {
+        ExpectEqual(((TestData_t*)LL_GetData(LL_CursorGetNode(&Cursor)))->Id, Ids[i]);
+        ExpectResponse(LL_CursorNext(&Cursor), (i + 1 < NumIds ? LL_OK : LL_NOT_OK));
+    }
+    ExpectEqualPtr(LL_CursorGetNode(&Cursor), LL_GetTail(List));
+
+    /* Traverse backward with a cursor */
+    if (List->Linkage != LL_SINGLE)
+    {
+        ExpectResponse(LL_CursorToTail(List, &Cursor), LL_OK);
+        for(unsigned int i = NumIds; i > 0; i--)
+        {
+            ExpectEqual(((TestData_t*)LL_GetData(LL_CursorGetNode(&Cursor)))->Id, Ids[i - 1]);
+            ExpectResponse(LL_CursorPrev(&Cursor), (i > 1 ? LL_OK : LL_NOT_OK));
+        }
+        ExpectEqualPtr(LL_CursorGetNode(&Cursor), LL_GetHead(List));
+    }
+}
+
 static void TestStart(const char* const Header)
 {
     printf("%s\n", Header);
@@ -1399,3 +3946,164 @@ static void TestEnd(void)
     TestStartEndBalance--;
 }
 
+static void* TestAlloc(size_t Size, void* Ctx)
+{
+    /* Like some allocators, refuse empty allocations */
+    if(Size == 0)
+    {
+        return NULL;
+    }
+    ((TestAllocator_t*)Ctx)->NumAllocs++;
+    return malloc(Size);
+}
+
+static void TestFree(void* Ptr, void* Ctx)
+{
+    ((TestAllocator_t*)Ctx)->NumFrees++;
+    free(Ptr);
+}
+
+static void TestLock(TestMutex_t* Mutex)
+{
+#if defined(_WIN32)
+    EnterCriticalSection(Mutex);
+#else
+    pthread_mutex_lock(Mutex);
+#endif
+}
+
+static void TestUnlock(TestMutex_t* Mutex)
+{
+#if defined(_WIN32)
+    LeaveCriticalSection(Mutex);
+#else
+    pthread_mutex_unlock(Mutex);
+#endif
+}
+
+static void* TestSharedAlloc(size_t Size, void* Ctx)
+{
+    TestSharedAllocator_t* Allocator = Ctx;
+    TestLock(&Allocator->Mutex);
+    void* Ptr = TestAlloc(Size, &Allocator->Counts);
+    TestUnlock(&Allocator->Mutex);
+    return Ptr;
+}
+
+static void TestSharedFree(void* Ptr, void* Ctx)
+{
+    TestSharedAllocator_t* Allocator = Ctx;
+    TestLock(&Allocator->Mutex);
+    TestFree(Ptr, &Allocator->Counts);
+    TestUnlock(&Allocator->Mutex);
+}
+
+/* Each thread gets the worker it runs as its argument */
+static TestThreadFn_t WorkerFn;
+
+#if defined(_WIN32)
+static DWORD WINAPI RunWorker(LPVOID Worker)
+{
+    WorkerFn((TestWorker_t*)Worker);
+    return 0;
+}
+#else
+static void* RunWorker(void* Worker)
+{
+    WorkerFn((TestWorker_t*)Worker);
+    return NULL;
+}
+#endif
+
+static void RunWorkers(TestThreadFn_t Fn, TestWorker_t* Workers, unsigned int NumWorkers)
+{
+    /* Runs Fn for every worker at the same time, each in its own thread */
+    TestThread_t Threads[16];
+    WorkerFn = Fn;
+
+    for(unsigned int i = 0; i < NumWorkers; i++)
+    {
+#if defined(_WIN32)
+        Threads[i] = CreateThread(NULL, 0, RunWorker, &Workers[i], 0, NULL);
+#else
+        pthread_create(&Threads[i], NULL, RunWorker, &Workers[i]);
+#endif
+    }
+
+    for(unsigned int i = 0; i < NumWorkers; i++)
+    {
+#if defined(_WIN32)
+        WaitForSingleObject(Threads[i], INFINITE);
+        CloseHandle(Threads[i]);
+#else
+        pthread_join(Threads[i], NULL);
+#endif
+    }
+}
+
+static void ChurnSplitPart(TestWorker_t* Worker)
+{
+    /* Add and remove nodes, and split off nodes and splice them back, which joins and leaves the pool
+       group shared with the other parts. The list grows by 25 nodes per round. */
+    List_t* List = Worker->List;
+
+    for(unsigned int Round = 0; Round < 200; Round++)
+    {
+        for(unsigned int i = 0; i < 50; i++)
+        {
+            Worker->NumErrors += (LL_AddToBack(List, &TestData[i % 5]) != LL_OK);
+        }
+        for(unsigned int i = 0; i < 25; i++)
+        {
+            Worker->NumErrors += (LL_RemoveHead(List) != LL_OK);
+        }
+
+        List_t* Back = NULL;
+        Worker->NumErrors += (LL_SplitAfter(LL_GetHead(List), &Back) != LL_OK);
+        if(Back)
+        {
+            Worker->NumErrors += (LL_Splice(List, LL_GetTail(List), LL_GetHead(Back), LL_GetTail(Back)) != LL_OK);
+            Worker->NumErrors += (LL_DeleteList(Back) != LL_OK);
+        }
+    }
+}
+
+static void ReadMergedList(TestWorker_t* Worker)
+{
+    /* Go through the list both ways, many times. The list is shared by the threads, only read. */
+    List_t* List = Worker->List;
+
+    for(unsigned int Round = 0; Round < 50; Round++)
+    {
+        unsigned int Count = 0;
+        for(ListNode_t* Node = LL_GetHead(List); Node; Node = LL_GetNext(Node))
+        {
+            Count += (LL_GetData(Node) != NULL);
+        }
+        for(ListNode_t* Node = LL_GetTail(List); Node; Node = LL_GetPrev(Node))
+        {
+            Count--;
+        }
+        Worker->NumErrors += (Count != 0);
+    }
+}
+
+static int CompareInts(const void* A, const void* B)
+{
+    int IntA = *(const int*)A;
+    int IntB = *(const int*)B;
+    return (IntA > IntB) - (IntA < IntB);
+}
+
+static int CompareIntsDescending(const void* A, const void* B)
+{
+    return CompareInts(B, A);
+}
+
+static ListBool_t CollectIds(void* Data, void* Ctx)
+{
+    /* Ctx is an array of ids: [0] is the number of ids collected, [1] the number to collect */
+    int* Ids = Ctx;
+    Ids[2 + Ids[0]++] = ((TestData_t*)Data)->Id;
+    return (Ids[0] < Ids[1] ? LL_TRUE : LL_FALSE);
+}